@@ -0,0 +1,40 @@
+#include "BitStream.h"
+
+void BitWriter::write(uint32_t value, int bits) {
+    if (bits < 32) {
+        value &= (uint32_t(1) << bits) - 1;
+    }
+    scratch |= uint64_t(value) << scratchBits;
+    scratchBits += bits;
+    while (scratchBits >= 8) {
+        data.push_back(uint8_t(scratch));
+        scratch >>= 8;
+        scratchBits -= 8;
+    }
+}
+
+void BitWriter::flush() {
+    if (scratchBits > 0) {
+        data.push_back(uint8_t(scratch));
+        scratch = 0;
+        scratchBits = 0;
+    }
+}
+
+uint32_t BitReader::read(int bits) {
+    while (scratchBits < bits) {
+        if (position < size) {
+            scratch |= uint64_t(data[position++]) << scratchBits;
+        } else {
+            overflow = true;
+        }
+        scratchBits += 8;
+    }
+    uint32_t value = uint32_t(scratch);
+    if (bits < 32) {
+        value &= (uint32_t(1) << bits) - 1;
+    }
+    scratch >>= bits;
+    scratchBits -= bits;
+    return value;
+}
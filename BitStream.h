@@ -0,0 +1,55 @@
+#ifndef BITSTREAM_H
+#define BITSTREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Packs values of any width from 1 to 32 bits back to back, least
+// significant bit first, with no padding between them
+class BitWriter {
+public:
+    BitWriter() : data(ownData), scratch(0), scratchBits(0) {}
+    // Append to an existing buffer, e.g. a message being built, instead of
+    // allocating a new one
+    explicit BitWriter(std::vector<uint8_t>& target) : data(target), scratch(0), scratchBits(0) {}
+
+    BitWriter(const BitWriter&) = delete;
+    BitWriter& operator=(const BitWriter&) = delete;
+
+    void write(uint32_t value, int bits);
+    void writeBool(bool value) { write(value ? 1 : 0, 1); }
+    // Write any bits still held back; call once before using bytes()
+    void flush();
+
+    const std::vector<uint8_t>& bytes() const { return data; }
+
+private:
+    std::vector<uint8_t> ownData;
+    std::vector<uint8_t>& data;
+    uint64_t scratch;
+    int scratchBits;
+};
+
+// Reads what a BitWriter wrote. Reading past the end returns zeros and sets
+// overflowed(), so callers can check once after reading a whole message.
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size)
+        : data(data), size(size), position(0), scratch(0), scratchBits(0), overflow(false) {}
+
+    uint32_t read(int bits);
+    bool readBool() { return read(1) != 0; }
+
+    bool overflowed() const { return overflow; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t position; // Next byte to load into scratch
+    uint64_t scratch;
+    int scratchBits;
+    bool overflow;
+};
+
+#endif
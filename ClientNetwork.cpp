@@ -0,0 +1,167 @@
+#include "ClientNetwork.h"
+#include "Profiler.h"
+#include <iostream>
+#include <stdexcept>
+
+ClientNetwork::ClientNetwork()
+    : host(nullptr), peer(nullptr), running(false), connected(false), incoming(QUEUE_CAPACITY),
+      outgoing(QUEUE_CAPACITY) {
+}
+
+ClientNetwork::~ClientNetwork() {
+    disconnect(0);
+}
+
+void ClientNetwork::connect(const char* hostName, int port, int channels, int timeoutMs) {
+    if (thread.joinable()) {
+        throw std::runtime_error("Already connected");
+    }
+
+    if (!host) {
+        host = enet_host_create(NULL, 1, channels, 0, 0);
+        if (!host) {
+            throw std::runtime_error("Failed to create ENet client host");
+        }
+    }
+
+    ENetAddress address;
+    enet_address_set_host(&address, hostName);
+    address.port = port;
+
+    peer = enet_host_connect(host, &address, channels, 0);
+    if (!peer) {
+        throw std::runtime_error("Failed to connect to server");
+    }
+
+    // Wait for connection success/failure
+    ENetEvent event;
+    if (enet_host_service(host, &event, timeoutMs) <= 0 || event.type != ENET_EVENT_TYPE_CONNECT) {
+        enet_peer_reset(peer);
+        peer = nullptr;
+        throw std::runtime_error("Connection to server failed!");
+    }
+
+    // From here on only the network thread touches the host
+    connected = true;
+    running = true;
+    thread = std::thread(&ClientNetwork::threadLoop, this);
+}
+
+void ClientNetwork::disconnect(int timeoutMs) {
+    if (thread.joinable()) {
+        running = false;
+        thread.join();
+    }
+
+    // Drop whatever neither side got to
+    NetEvent event;
+    while (incoming.pop(event)) {
+        if (event.packet) {
+            enet_packet_destroy(event.packet);
+        }
+    }
+    for (const NetEvent& pending : backlog) {
+        if (pending.packet) {
+            enet_packet_destroy(pending.packet);
+        }
+    }
+    backlog.clear();
+    OutgoingPacket unsent;
+    while (outgoing.pop(unsent)) {
+        enet_packet_destroy(unsent.packet);
+    }
+
+    // Let the server acknowledge the disconnect, or drop the peer if it
+    // doesn't answer in time
+    if (peer && connected) {
+        enet_peer_disconnect(peer, 0);
+        bool acknowledged = false;
+        ENetEvent enetEvent;
+        while (!acknowledged && enet_host_service(host, &enetEvent, timeoutMs) > 0) {
+            if (enetEvent.type == ENET_EVENT_TYPE_RECEIVE) {
+                enet_packet_destroy(enetEvent.packet);
+            } else if (enetEvent.type == ENET_EVENT_TYPE_DISCONNECT) {
+                std::cout << "Disconnection succeeded." << std::endl;
+                acknowledged = true;
+            }
+        }
+        if (!acknowledged) {
+            enet_peer_reset(peer);
+        }
+    }
+    peer = nullptr;
+    connected = false;
+
+    if (host) {
+        enet_host_destroy(host);
+        host = nullptr;
+    }
+}
+
+bool ClientNetwork::send(const void* data, size_t size, enet_uint8 channel, enet_uint32 flags) {
+    if (!connected) {
+        return false;
+    }
+
+    ENetPacket* packet = enet_packet_create(data, size, flags);
+    if (!packet) {
+        return false;
+    }
+    OutgoingPacket outgoingPacket = {packet, channel};
+    if (!outgoing.push(outgoingPacket)) {
+        enet_packet_destroy(packet);
+        return false;
+    }
+    return true;
+}
+
+bool ClientNetwork::poll(NetEvent& event) {
+    return incoming.pop(event);
+}
+
+// Keeps events in order: once anything is waiting in the backlog, new
+// events queue up behind it
+void ClientNetwork::deliver(const NetEvent& event) {
+    if (!backlog.empty() || !incoming.push(event)) {
+        backlog.push_back(event);
+    }
+}
+
+void ClientNetwork::threadLoop() {
+    profilerSetThreadName("network");
+
+    while (running) {
+        // Queue outgoing packets first so this service call sends them
+        OutgoingPacket outgoingPacket;
+        while (outgoing.pop(outgoingPacket)) {
+            if (!connected ||
+                enet_peer_send(peer, outgoingPacket.channel, outgoingPacket.packet) < 0) {
+                enet_packet_destroy(outgoingPacket.packet);
+            }
+        }
+
+        while (!backlog.empty() && incoming.push(backlog.front())) {
+            backlog.pop_front();
+        }
+
+        // Sleeps in the socket until something arrives or the timeout passes;
+        // with a backlog we only poll so it drains as soon as there is room
+        ENetEvent enetEvent;
+        int result =
+            enet_host_service(host, &enetEvent, backlog.empty() ? SERVICE_TIMEOUT_MS : 0);
+        while (result > 0) {
+            PROFILE_SCOPE("net receive");
+            if (enetEvent.type == ENET_EVENT_TYPE_DISCONNECT) {
+                connected = false;
+            }
+            NetEvent event = {enetEvent.type, enetEvent.packet, enetEvent.channelID};
+            deliver(event);
+
+            // Handle everything already received before sleeping again
+            result = enet_host_check_events(host, &enetEvent);
+        }
+        if (result < 0) {
+            std::cerr << "ENet service failed on the network thread" << std::endl;
+        }
+    }
+}
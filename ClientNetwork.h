@@ -0,0 +1,70 @@
+#ifndef CLIENTNETWORK_H
+#define CLIENTNETWORK_H
+
+#include "SpscQueue.h"
+#include <atomic>
+#include <deque>
+#include <enet/enet.h>
+#include <thread>
+
+// Something that happened on the connection, handed to the game thread.
+// RECEIVE events own their packet; the game thread destroys it.
+struct NetEvent {
+    ENetEventType type;
+    ENetPacket* packet;
+    enet_uint8 channel;
+};
+
+// Client side of the ENet connection. After connect() the host is serviced
+// on a dedicated thread, so packets are received and acknowledged as they
+// arrive rather than once per rendered frame. The game thread talks to it
+// only through two lock-free queues: send() pushes outgoing packets and
+// poll() pops received events.
+class ClientNetwork {
+public:
+    ClientNetwork();
+    ~ClientNetwork();
+
+    ClientNetwork(const ClientNetwork&) = delete;
+    ClientNetwork& operator=(const ClientNetwork&) = delete;
+
+    // Blocks until the server accepts or timeoutMs passes, then starts the
+    // network thread. Throws std::runtime_error on failure.
+    void connect(const char* hostName, int port, int channels, int timeoutMs);
+    // Stop the thread and disconnect gracefully, waiting up to timeoutMs
+    void disconnect(int timeoutMs);
+
+    bool isConnected() const { return connected.load(); }
+
+    // Game thread only. Copies the data into a packet; returns false if the
+    // connection is down or the outgoing queue is full.
+    bool send(const void* data, size_t size, enet_uint8 channel, enet_uint32 flags);
+    // Game thread only. Returns false once there is nothing left to handle.
+    bool poll(NetEvent& event);
+
+private:
+    // How long the network thread sleeps in enet_host_service when idle;
+    // incoming packets wake it immediately, outgoing ones wait at most this
+    static const enet_uint32 SERVICE_TIMEOUT_MS = 1;
+    static const size_t QUEUE_CAPACITY = 1024;
+
+    struct OutgoingPacket {
+        ENetPacket* packet;
+        enet_uint8 channel;
+    };
+
+    void threadLoop();
+    void deliver(const NetEvent& event);
+
+    ENetHost* host;
+    ENetPeer* peer;
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<bool> connected;
+
+    SpscQueue<NetEvent> incoming;       // Network thread -> game thread
+    SpscQueue<OutgoingPacket> outgoing; // Game thread -> network thread
+    std::deque<NetEvent> backlog; // Network thread only, events waiting for room in `incoming`
+};
+
+#endif
@@ -0,0 +1,203 @@
+#include "FloorCaster.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define FLOORCASTER_HAVE_SSE2 1
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define FLOORCASTER_HAVE_AVX2 1
+#endif
+
+// Row setup shared by every kernel: where the row starts in world space and
+// how far one pixel moves along it
+struct FloorRow {
+    Uint32* floor;   // Destination row below the horizon
+    Uint32* ceiling; // Mirrored destination row above it
+    float startX, startY;
+    float stepX, stepY;
+};
+
+// Per-texture sampling constants
+struct FloorSampler {
+    const Uint32* texels;
+    int widthMask, heightMask;
+    int heightShift;
+    float width, height;
+};
+
+static FloorSampler makeSampler(const TextureStore& store, int texture) {
+    FloorSampler sampler;
+    sampler.texels = store.data(texture);
+    sampler.widthMask = store.width(texture) - 1;
+    sampler.heightMask = store.height(texture) - 1;
+    sampler.heightShift = store.heightShift(texture);
+    sampler.width = (float)store.width(texture);
+    sampler.height = (float)store.height(texture);
+    return sampler;
+}
+
+static FloorRow setupRow(const RayCamera& camera, int width, int height, int row, Uint32* pixels) {
+    // Vertical position of the camera, and of this row relative to the
+    // horizon, sampled at the pixel centre
+    double posZ = 0.5 * height;
+    double p = row + 0.5;
+    double rowDistance = posZ / p;
+
+    // Rays through the leftmost and rightmost columns
+    double rayDirX0 = camera.dirX - camera.planeX;
+    double rayDirY0 = camera.dirY - camera.planeY;
+    double rayDirX1 = camera.dirX + camera.planeX;
+    double rayDirY1 = camera.dirY + camera.planeY;
+
+    int y = height / 2 + row;
+
+    FloorRow floorRow;
+    floorRow.floor = pixels + y * width;
+    floorRow.ceiling = pixels + (height - 1 - y) * width;
+    floorRow.startX = (float)(camera.posX + rowDistance * rayDirX0);
+    floorRow.startY = (float)(camera.posY + rowDistance * rayDirY0);
+    floorRow.stepX = (float)(rowDistance * (rayDirX1 - rayDirX0) / width);
+    floorRow.stepY = (float)(rowDistance * (rayDirY1 - rayDirY0) / width);
+    return floorRow;
+}
+
+static inline Uint32 sampleFloor(const FloorSampler& s, float worldX, float worldY) {
+    int tx = int(worldX * s.width) & s.widthMask;
+    int ty = int(worldY * s.height) & s.heightMask;
+    return s.texels[(tx << s.heightShift) + ty];
+}
+
+static void castFloorPixelsScalar(const FloorRow& row, const FloorSampler& floor,
+                                  const FloorSampler& ceiling, int begin, int end) {
+    for (int x = begin; x < end; x++) {
+        float worldX = row.startX + x * row.stepX;
+        float worldY = row.startY + x * row.stepY;
+        row.floor[x] = sampleFloor(floor, worldX, worldY);
+        row.ceiling[x] = sampleFloor(ceiling, worldX, worldY);
+    }
+}
+
+#ifdef FLOORCASTER_HAVE_SSE2
+static inline __m128i texelIndexSSE2(const FloorSampler& s, __m128 worldX, __m128 worldY) {
+    __m128i tx = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(worldX, _mm_set1_ps(s.width))),
+                               _mm_set1_epi32(s.widthMask));
+    __m128i ty = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(worldY, _mm_set1_ps(s.height))),
+                               _mm_set1_epi32(s.heightMask));
+    return _mm_add_epi32(_mm_sll_epi32(tx, _mm_cvtsi32_si128(s.heightShift)), ty);
+}
+
+// Coordinates and texel indices 4 pixels at a time; SSE2 has no gather so
+// the fetches themselves are scalar
+static void castFloorPixelsSSE2(const FloorRow& row, const FloorSampler& floor,
+                                const FloorSampler& ceiling, int width) {
+    const __m128 startX = _mm_set1_ps(row.startX);
+    const __m128 startY = _mm_set1_ps(row.startY);
+    const __m128 stepX = _mm_set1_ps(row.stepX);
+    const __m128 stepY = _mm_set1_ps(row.stepY);
+    const __m128 laneOffset = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        __m128 column = _mm_add_ps(_mm_set1_ps((float)x), laneOffset);
+        __m128 worldX = _mm_add_ps(startX, _mm_mul_ps(column, stepX));
+        __m128 worldY = _mm_add_ps(startY, _mm_mul_ps(column, stepY));
+
+        alignas(16) int floorIndex[4], ceilingIndex[4];
+        _mm_store_si128((__m128i*)floorIndex, texelIndexSSE2(floor, worldX, worldY));
+        _mm_store_si128((__m128i*)ceilingIndex, texelIndexSSE2(ceiling, worldX, worldY));
+
+        __m128i floorTexels = _mm_set_epi32(
+            floor.texels[floorIndex[3]], floor.texels[floorIndex[2]],
+            floor.texels[floorIndex[1]], floor.texels[floorIndex[0]]);
+        __m128i ceilingTexels = _mm_set_epi32(
+            ceiling.texels[ceilingIndex[3]], ceiling.texels[ceilingIndex[2]],
+            ceiling.texels[ceilingIndex[1]], ceiling.texels[ceilingIndex[0]]);
+
+        _mm_storeu_si128((__m128i*)(row.floor + x), floorTexels);
+        _mm_storeu_si128((__m128i*)(row.ceiling + x), ceilingTexels);
+    }
+
+    castFloorPixelsScalar(row, floor, ceiling, x, width);
+}
+#endif
+
+#ifdef FLOORCASTER_HAVE_AVX2
+__attribute__((target("avx2"))) static inline __m256i texelIndexAVX2(const FloorSampler& s,
+                                                                      __m256 worldX,
+                                                                      __m256 worldY) {
+    __m256i tx = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_mul_ps(worldX, _mm256_set1_ps(s.width))),
+                                  _mm256_set1_epi32(s.widthMask));
+    __m256i ty = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_mul_ps(worldY, _mm256_set1_ps(s.height))),
+                                  _mm256_set1_epi32(s.heightMask));
+    return _mm256_add_epi32(_mm256_sll_epi32(tx, _mm_cvtsi32_si128(s.heightShift)), ty);
+}
+
+// 8 pixels at a time with hardware gathers for the texels
+__attribute__((target("avx2"))) static void castFloorPixelsAVX2(const FloorRow& row,
+                                                                const FloorSampler& floor,
+                                                                const FloorSampler& ceiling,
+                                                                int width) {
+    const __m256 startX = _mm256_set1_ps(row.startX);
+    const __m256 startY = _mm256_set1_ps(row.startY);
+    const __m256 stepX = _mm256_set1_ps(row.stepX);
+    const __m256 stepY = _mm256_set1_ps(row.stepY);
+    const __m256 laneOffset = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m256 column = _mm256_add_ps(_mm256_set1_ps((float)x), laneOffset);
+        __m256 worldX = _mm256_add_ps(startX, _mm256_mul_ps(column, stepX));
+        __m256 worldY = _mm256_add_ps(startY, _mm256_mul_ps(column, stepY));
+
+        __m256i floorTexels = _mm256_i32gather_epi32((const int*)floor.texels,
+                                                     texelIndexAVX2(floor, worldX, worldY), 4);
+        __m256i ceilingTexels = _mm256_i32gather_epi32((const int*)ceiling.texels,
+                                                       texelIndexAVX2(ceiling, worldX, worldY), 4);
+
+        _mm256_storeu_si256((__m256i*)(row.floor + x), floorTexels);
+        _mm256_storeu_si256((__m256i*)(row.ceiling + x), ceilingTexels);
+    }
+
+    castFloorPixelsScalar(row, floor, ceiling, x, width);
+}
+#endif
+
+RayKernelType bestFloorKernel() {
+    if (rayKernelSupported(RAY_KERNEL_AVX2))
+        return RAY_KERNEL_AVX2;
+    if (rayKernelSupported(RAY_KERNEL_SSE2))
+        return RAY_KERNEL_SSE2;
+    return RAY_KERNEL_SCALAR;
+}
+
+int floorRowCount(int height) {
+    return height - height / 2;
+}
+
+void castFloorRows(RayKernelType kernel, const RayCamera& camera, int width, int height,
+                   int firstRow, int lastRow, const FloorTextures& textures, Uint32* pixels) {
+    FloorSampler floor = makeSampler(*textures.store, textures.floorTexture);
+    FloorSampler ceiling = makeSampler(*textures.store, textures.ceilingTexture);
+
+    for (int r = firstRow; r < lastRow; r++) {
+        FloorRow row = setupRow(camera, width, height, r, pixels);
+
+        switch (kernel) {
+#ifdef FLOORCASTER_HAVE_AVX2
+        case RAY_KERNEL_AVX2:
+            castFloorPixelsAVX2(row, floor, ceiling, width);
+            break;
+#endif
+#ifdef FLOORCASTER_HAVE_SSE2
+        case RAY_KERNEL_SSE2:
+            castFloorPixelsSSE2(row, floor, ceiling, width);
+            break;
+#endif
+        default:
+            castFloorPixelsScalar(row, floor, ceiling, 0, width);
+            break;
+        }
+    }
+}
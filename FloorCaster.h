@@ -0,0 +1,28 @@
+#ifndef FLOORCASTER_H
+#define FLOORCASTER_H
+
+#include "RayKernel.h"
+#include "TextureStore.h"
+
+// Textured floor and ceiling, cast one horizontal scanline at a time: every
+// floor row is a fixed distance from the camera, so a row needs one
+// world-space start point and one step, and its texels are fetched in SIMD
+// batches along the row.
+struct FloorTextures {
+    const TextureStore* store;
+    int floorTexture;
+    int ceilingTexture;
+};
+
+// Widest floor kernel the CPU can run
+RayKernelType bestFloorKernel();
+
+// Fill floor rows [firstRow, lastRow) counted down from the horizon, and the
+// matching ceiling rows mirrored above it, in a width x height buffer
+void castFloorRows(RayKernelType kernel, const RayCamera& camera, int width, int height,
+                   int firstRow, int lastRow, const FloorTextures& textures, Uint32* pixels);
+
+// Number of floor rows in a view of the given height
+int floorRowCount(int height);
+
+#endif
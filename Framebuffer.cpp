@@ -0,0 +1,72 @@
+#include "Framebuffer.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+// Convert any surface to ARGB8888 and copy its pixels out
+PixelImage loadPixelImage(SDL_Surface* surface) {
+    PixelImage image;
+
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    if (!converted) {
+        throw std::runtime_error("Failed to convert surface: " + std::string(SDL_GetError()));
+    }
+
+    image.width = converted->w;
+    image.height = converted->h;
+    image.pixels.resize(image.width * image.height);
+
+    SDL_LockSurface(converted);
+    // Copy row by row since the surface pitch may include padding
+    for (int y = 0; y < image.height; y++) {
+        const Uint32* row = (const Uint32*)((const Uint8*)converted->pixels + y * converted->pitch);
+        std::copy(row, row + image.width, image.pixels.begin() + y * image.width);
+    }
+    SDL_UnlockSurface(converted);
+    SDL_FreeSurface(converted);
+
+    return image;
+}
+
+Framebuffer createFramebuffer(SDL_Renderer* renderer, int width, int height) {
+    Framebuffer fb;
+    fb.width = width;
+    fb.height = height;
+    fb.maxWidth = width;
+    fb.maxHeight = height;
+    fb.pixels.assign(width * height, 0xFF000000);
+
+    fb.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                   SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (!fb.texture) {
+        throw std::runtime_error("Failed to create framebuffer texture: " + std::string(SDL_GetError()));
+    }
+
+    return fb;
+}
+
+// Change the render size without reallocating, clamped to the allocated size
+void resizeFramebuffer(Framebuffer& fb, int width, int height) {
+    fb.width = std::max(1, std::min(width, fb.maxWidth));
+    fb.height = std::max(1, std::min(height, fb.maxHeight));
+}
+
+void clearFramebuffer(Framebuffer& fb, Uint32 color) {
+    std::fill(fb.pixels.begin(), fb.pixels.begin() + fb.width * fb.height, color);
+}
+
+// Upload the rendered part in one call and stretch it over the window with a
+// single copy
+void presentFramebuffer(SDL_Renderer* renderer, Framebuffer& fb) {
+    SDL_Rect area = {0, 0, fb.width, fb.height};
+    SDL_UpdateTexture(fb.texture, &area, fb.pixels.data(), fb.width * sizeof(Uint32));
+    SDL_RenderCopy(renderer, fb.texture, &area, NULL);
+}
+
+void destroyFramebuffer(Framebuffer& fb) {
+    if (fb.texture) {
+        SDL_DestroyTexture(fb.texture);
+        fb.texture = nullptr;
+    }
+    fb.pixels.clear();
+}
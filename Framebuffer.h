@@ -0,0 +1,34 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// CPU-side copy of an image in ARGB8888, used by the software raycaster
+struct PixelImage {
+    int width = 0;
+    int height = 0;
+    std::vector<Uint32> pixels; // Row-major, width * height texels
+};
+
+// 32-bit pixel buffer the raycaster draws into, uploaded once per frame.
+// The render size can shrink below the allocated size; the rendered part is
+// stretched over the whole window when presented.
+struct Framebuffer {
+    int width = 0;  // Current render size, also the row stride of `pixels`
+    int height = 0;
+    int maxWidth = 0; // Allocated size of `pixels` and `texture`
+    int maxHeight = 0;
+    std::vector<Uint32> pixels;
+    SDL_Texture* texture = nullptr; // Streaming texture the pixels are uploaded to
+};
+
+// Function prototypes
+PixelImage loadPixelImage(SDL_Surface* surface);
+Framebuffer createFramebuffer(SDL_Renderer* renderer, int width, int height);
+void resizeFramebuffer(Framebuffer& fb, int width, int height);
+void clearFramebuffer(Framebuffer& fb, Uint32 color);
+void presentFramebuffer(SDL_Renderer* renderer, Framebuffer& fb);
+void destroyFramebuffer(Framebuffer& fb);
+
+#endif
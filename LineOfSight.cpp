@@ -0,0 +1,85 @@
+#include "LineOfSight.h"
+#include "Map.h"
+#include <cmath>
+
+bool hasWallBetweenPoints(double startX, double startY, double endX, double endY) {
+    // Implementation of Digital Differential Analyzer (DDA) algorithm
+    double dirX = endX - startX;
+    double dirY = endY - startY;
+    double distance = sqrt(dirX * dirX + dirY * dirY);
+    if (distance < 1e-9) {
+        return false;
+    }
+
+    // Normalize direction vector
+    dirX /= distance;
+    dirY /= distance;
+
+    // Starting map cell
+    int mapX = int(startX);
+    int mapY = int(startY);
+
+    // Length of ray from one x or y-side to next x or y-side
+    double deltaDistX = std::abs(1.0 / dirX);
+    double deltaDistY = std::abs(1.0 / dirY);
+
+    // Calculate step and initial sideDist
+    double sideDistX, sideDistY;
+    int stepX, stepY;
+
+    if (dirX < 0) {
+        stepX = -1;
+        sideDistX = (startX - mapX) * deltaDistX;
+    } else {
+        stepX = 1;
+        sideDistX = (mapX + 1.0 - startX) * deltaDistX;
+    }
+
+    if (dirY < 0) {
+        stepY = -1;
+        sideDistY = (startY - mapY) * deltaDistY;
+    } else {
+        stepY = 1;
+        sideDistY = (mapY + 1.0 - startY) * deltaDistY;
+    }
+
+    // Perform DDA
+    while (true) {
+        // Jump to next map square, unless the end point comes first
+        if (sideDistX < sideDistY) {
+            if (sideDistX > distance) {
+                break;
+            }
+            sideDistX += deltaDistX;
+            mapX += stepX;
+        } else {
+            if (sideDistY > distance) {
+                break;
+            }
+            sideDistY += deltaDistY;
+            mapY += stepY;
+        }
+
+        // Check if ray has hit a wall
+        if (mapX < 0 || mapX >= MAP_WIDTH || mapY < 0 || mapY >= MAP_HEIGHT) {
+            return true; // Hit map boundary
+        }
+
+        if (worldMap[mapX][mapY] > 0) {
+            return true; // Hit a wall
+        }
+    }
+
+    return false; // No walls between points
+}
+
+// FNV-1a over the cells in index order
+uint32_t mapChecksum() {
+    uint32_t hash = 2166136261u;
+    for (int x = 0; x < MAP_WIDTH; x++) {
+        for (int y = 0; y < MAP_HEIGHT; y++) {
+            hash = (hash ^ uint32_t(worldMap[x][y])) * 16777619u;
+        }
+    }
+    return hash;
+}
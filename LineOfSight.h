@@ -0,0 +1,18 @@
+#ifndef LINEOFSIGHT_H
+#define LINEOFSIGHT_H
+
+#include <cstdint>
+
+// Exact line-of-sight tests against worldMap, shared by the server and the
+// map tools
+
+// Function prototypes
+// True if a wall or the map edge lies on the line between the two points.
+// Walks the cells the line crosses with a DDA, so the cost grows with the
+// distance.
+bool hasWallBetweenPoints(double startX, double startY, double endX, double endY);
+// Fingerprint of worldMap, to tell whether data precomputed from it is
+// still current
+uint32_t mapChecksum();
+
+#endif
@@ -2,11 +2,9 @@
 #include <iostream>
 #include <SDL2/SDL2_gfxPrimitives.h>
 
-Lobby::Lobby(SDL_Renderer* renderer) : renderer(renderer), isAdmin(false), isHovering(false), isClicked(false) {
-    font = TTF_OpenFont("arial.ttf", 24);
-    if (!font) {
-        std::cerr << "Failed to load font: " << TTF_GetError() << std::endl;
-    }
+Lobby::Lobby(SDL_Renderer* renderer, const TextRenderer& text)
+    : renderer(renderer), text(text), isAdmin(false), isHovering(false), isClicked(false) {
+    text.setPosition(statusLabel, 50, 100);
 
     // Play button size and position
     playButtonRect.w = 200;
@@ -16,7 +14,6 @@ Lobby::Lobby(SDL_Renderer* renderer) : renderer(renderer), isAdmin(false), isHov
 }
 
 Lobby::~Lobby() {
-    TTF_CloseFont(font);
 }
 
 void Lobby::render() {
@@ -34,21 +31,8 @@ void Lobby::render() {
     }
     lobbyText += "Players in Lobby: " + std::to_string(playersInLobby.size()) + "/4. Press Enter to Start Match.";
 
-    SDL_Surface* surfaceMessage = TTF_RenderText_Solid(font, lobbyText.c_str(), textColor);
-    SDL_Texture* message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
-
-    SDL_Rect messageRect = {50, 100, surfaceMessage->w, surfaceMessage->h};
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-    if (SDL_GetError()[0] != '\0') {
-        std::cerr << "SDL Error after rendering text: " << SDL_GetError() << std::endl;
-        SDL_ClearError();
-    }
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
-
-    // ✅ Ensure only one `SDL_RenderPresent()` call at the end
-    SDL_RenderPresent(renderer);
+    text.setText(statusLabel, lobbyText, textColor);
+    text.draw(statusLabel);
 }
 
 
@@ -5,10 +5,11 @@
 #include <SDL2/SDL_ttf.h>
 #include <vector>
 #include "common.h"
+#include "TextRenderer.h"
 
 class Lobby {
 public:
-    Lobby(SDL_Renderer* renderer);
+    Lobby(SDL_Renderer* renderer, const TextRenderer& text);
     ~Lobby();
 
     void render();
@@ -18,7 +19,8 @@ public:
 
 private:
     SDL_Renderer* renderer;
-    TTF_Font* font;
+    const TextRenderer& text;
+    TextLabel statusLabel; // Only laid out again when the text changes
 
     std::vector<PlayerState> playersInLobby;
     bool isAdmin;
@@ -0,0 +1,1740 @@
+// Generated by mapcompile from Map.h; do not edit. Run `make MapVisibility.h`
+// after changing the map.
+#pragma once
+
+#include <cstdint>
+
+// Checksum of the worldMap this was built from
+const uint32_t MAP_PVS_CHECKSUM = 0xea59c0cau;
+
+// Row per cell (x * MAP_HEIGHT + y), one bit per cell it may see
+const uint32_t MAP_PVS[576 * 18] = {
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x007fffff, 0x81007f81, 0xe781007f, 0x15c7811c, 0x80178f80,
+    0x0f8037cf, 0x003f8000, 0x80f82f80, 0x2f80002f, 0x000f8000, 0xbc001f80,
+    0x1fa4001f, 0x001fa400, 0xa0003fac, 0x0fbc007f, 0x000f8000, 0xffffff80,
+    0xffffffff, 0x007fffff, 0x81007f81, 0xe781007f, 0x15c7811c, 0x8017c780,
+    0x078037c7, 0x063f8003, 0x80fc2780, 0x27800c27, 0x30078018, 0xbc700780,
+    0x07a46007, 0x8007a4c0, 0xa38007ad, 0x07bf007f, 0x00078600, 0xffffff8e,
+    0xffffffff, 0x007fffff, 0x81007f81, 0xe981007d, 0x15e9811c, 0x8017e980,
+    0x098037c9, 0x06398003, 0x80fe2980, 0x29800c29, 0x38098018, 0xbc700980,
+    0x09a46009, 0xc009a4e0, 0xa38009ad, 0x09bf8079, 0x00098700, 0xffffff8e,
+    0xffffffff, 0x007fffff, 0x81007d81, 0x7181007d, 0x14f1811c, 0x8015f180,
+    0x718037f1, 0x06798003, 0x80fe7180, 0xf1800c71, 0x18d18018, 0xbc30d180,
+    0xd1a460d1, 0xc1d1a460, 0xa181d1ac, 0x91bd81f9, 0x01918301, 0xffffff86,
+    0xffffffff, 0x007fffff, 0x81007d81, 0x7181007d, 0x1471811c, 0x8014f980,
+    0x798036f9, 0x00798000, 0x80f86180, 0x61800061, 0x00618000, 0xbc00e180,
+    0xe1a400e1, 0x00e1a400, 0xa000e1ac, 0xa1bc00f9, 0x01a18000, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffc5ffff, 0x81ffc5ff, 0xc181ffdd, 0xd7c181ff, 0x9f97e187,
+    0xa1ff37e1, 0x03b9fe03, 0xf0fba1f8, 0xa1e007a1, 0x0781c007, 0xbc0f8180,
+    0x81a40f81, 0x0f81a40f, 0xa01f81ac, 0x81bc1ff9, 0x3f81801f, 0xffffff80,
+    0xffffffff, 0xffc5ffff, 0x81ffc5ff, 0xc181ffdd, 0xf7e181ff, 0x9fd7f187,
+    0xb9ffb7f1, 0x03b9ff03, 0xfcfba1fe, 0xa1f803a1, 0x0381f003, 0xfc07c1e0,
+    0xc1a407c1, 0x07c1a407, 0xa007c1ac, 0xc1bc07f9, 0x0fc18007, 0xffffff80,
+    0xffffffff, 0xffc5ffff, 0x81ffc5ff, 0xe181ffdd, 0xf7f181ff, 0x8fd7f983,
+    0xbfbfb7fd, 0x03bfff83, 0xfefba7ff, 0xe1fc03e3, 0x03c1fc03, 0xfc03e1f8,
+    0xe1e403e1, 0x03e1a403, 0xa003f1ac, 0xc1bc03f9, 0x03c18003, 0xffffff80,
+    0xffffffff, 0xffc5ffff, 0xc1ffc5ff, 0xe181ffdd, 0xf7f181ff, 0x8ff7fd83,
+    0xbf9ff7ff, 0x85bfffc5, 0xfffde7ff, 0xe1ff05e3, 0x05e1ff05, 0xfe05e1fe,
+    0xf1e404f1, 0x04f9a404, 0xa004f9ac, 0xc1bc04f9, 0x04c18004, 0xffffff80,
+    0xffffffff, 0xffc5ffff, 0xe1ffc5ff, 0xe181ffdd, 0xfff981ff, 0x87ffff83,
+    0xbf8fffff, 0xc9ffbfc9, 0xfff9e7ff, 0xe1ff08e3, 0x08e1ff08, 0xfe08e1fe,
+    0x71e60871, 0x0879a408, 0xa00839ac, 0x01bc0879, 0x08018008, 0xffffff80,
+    0xffffffff, 0xffc5ffff, 0xf1ffc5ff, 0xf181ffdd, 0xf7fd81ff, 0x87f7ff83,
+    0xbf8ff7ff, 0xd0ff9fd1, 0xfff8e7bf, 0x61ff1063, 0x1001ff10, 0xfe1001ff,
+    0x01e61001, 0x1001a610, 0xa01001ac, 0x01bc1079, 0x10018010, 0xffffff80,
+    0xffffffff, 0xffc5ffff, 0xf9ffc5ff, 0xf1c1ffdd, 0xf7fd81ff, 0x83f5ff81,
+    0x3f87f6ff, 0xe03f8fe0, 0x9ff8238f, 0x21bf2021, 0x2001ff20, 0xff2001ff,
+    0x01e72001, 0x2001a620, 0xa62001ae, 0x01be2079, 0x20018620, 0xffffff84,
+    0xffffffff, 0xffc5ffff, 0xfdffc5ff, 0xf1f1ffdd, 0xf7ffc1ff, 0x83f5ff81,
+    0x1f83f6ff, 0xe03f87e0, 0x8ff82387, 0x218f4021, 0x40019f40, 0xbf40019f,
+    0x01a74001, 0x4001a740, 0xa74001af, 0x01bf4079, 0x40018740, 0xffffff86,
+    0xffffffff, 0xffc5ffff, 0xffffc5ff, 0xf9fdffdd, 0xf5fff9ff, 0xe1f4fff1,
+    0x1fc1f6ff, 0xe03f83e0, 0x83f82383, 0x21838021, 0x80018780, 0xbf800187,
+    0x01a78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xffffffff, 0xffc5ffff, 0xffffc5ff, 0xf9ffffdd, 0xf5ffffff, 0xfff4ffff,
+    0x1ffff6ff, 0xe03fffe0, 0xfff823ff, 0x21ff8021, 0x8001ff80, 0xff8001ff,
+    0x01e78001, 0x8001e780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xffffffff, 0xffc5ffff, 0xffffc5ff, 0xf9ff7fdd, 0x15ffff3f, 0xff147fff,
+    0x0fff36df, 0x803bff80, 0xfff821ff, 0x21ff8021, 0x8001ff80, 0xff8001ff,
+    0x01e7c001, 0xc001e7c0, 0xa7c001ef, 0x01bfc079, 0xe00187e0, 0xffffff87,
+    0xffffffff, 0xffc5ffff, 0xff7fc5ff, 0xf9ff1fdd, 0x15ffff1f, 0xff947fff,
+    0x07ffb6df, 0xc039ffc0, 0xfff821ff, 0x21ff8021, 0x8001ff80, 0xffc001ff,
+    0x01e7c001, 0xe001e7c0, 0xe7e001ef, 0x01bfe079, 0xf00187f0, 0xffffff87,
+    0xffffffff, 0xffc5ffff, 0xff3fc5ff, 0xf9ff07dd, 0x141fff1c, 0xff9403ff,
+    0x01fff6c1, 0xe039ffe0, 0xfff821ff, 0x21ff8021, 0xc001ff80, 0xffc001ff,
+    0x01efe001, 0xe001efe0, 0xebf001ef, 0x01fff079, 0xf801cbf8, 0xffffffcb,
+    0xffffffff, 0xffc5ffff, 0xff1fc5ff, 0x01ff01dd, 0x9401ff1c, 0xffd401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ffc0, 0xffe001ff,
+    0x01f7e001, 0xf001f7f0, 0xf3f801ff, 0x01fff879, 0xfc01d3fc, 0xffffffd3,
+    0xffffffff, 0xffc5ffff, 0xff0fc5ff, 0x01ff005d, 0x9401ff1c, 0xffd401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ffc0, 0xffe001ff,
+    0x01e7f001, 0xf801e7f0, 0xe3f801ef, 0x01fdfc79, 0xfe01e1fe, 0xffffffe1,
+    0xffffffff, 0xffc5ffff, 0xff07c5ff, 0x01ff005d, 0x9401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xe001ffc0, 0xffe001ff,
+    0x01e7f001, 0xf801e7f8, 0xe1fc01ef, 0x01fdfe79, 0xff01e1ff, 0xffffffe1,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x7fffffff, 0xffff8000, 0x810047ff, 0x0781005f, 0x140f811c, 0x80140f80,
+    0x1f8036df, 0x003f8000, 0x80f82f80, 0x2f80002f, 0x001f8000, 0xbc001f80,
+    0x1fa4001f, 0x003fa400, 0xa0003fac, 0x0fbc007f, 0x000f8000, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x7fffffff, 0xffff8000, 0x81007dff, 0xe981007d, 0x15e9811c, 0x8017c980,
+    0x098037c9, 0x06398003, 0x80fe2980, 0x29800c29, 0x38098018, 0xbc700980,
+    0x09a46009, 0xc009a4e0, 0xa38009ad, 0x09bf8079, 0x00098700, 0xffffff8e,
+    0x7fffffff, 0xffff8000, 0x81007dff, 0xf181007d, 0x15f1811c, 0x8017f180,
+    0x718037f1, 0x06798003, 0x80fe7180, 0xf1800c71, 0x38d18018, 0xbc70d180,
+    0xd1a460d1, 0xc1d1a4e0, 0xa38191ad, 0x91bf81f9, 0x01918701, 0xffffff8e,
+    0x7fffffff, 0xffff8000, 0x81007dff, 0x7181007d, 0x14f9811c, 0x8014f980,
+    0x7d8036fd, 0x007f8000, 0x80f86780, 0x63800067, 0x00e38000, 0xbc00e380,
+    0xe1a400e1, 0x00e1a400, 0xa000e1ac, 0xa1bc01f9, 0x01a18001, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xc181ffdd, 0xd7e181ff, 0xff17e18f,
+    0xb1fe37f1, 0x03b9f803, 0xc0ffa1e0, 0xa18007a1, 0x0f818007, 0xbc0f8180,
+    0x81a40f81, 0x1f81a41f, 0xa01f81ac, 0x81bc3ff9, 0x3f81803f, 0xffffff80,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xe181ffdd, 0xd7f181ff, 0xbf97f987,
+    0xbfff37fd, 0x03bffc03, 0xf0fba7f8, 0xa1c003a3, 0x07c18003, 0xbc07c180,
+    0xc1a407c1, 0x07c1a407, 0xa007c1ac, 0xc1bc0ff9, 0x0fc1800f, 0xffffff80,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xe181ffdd, 0xf7f981ff, 0x9fd7fd87,
+    0xbfffb7ff, 0x03bfff03, 0xfcfbe7fe, 0xe1f803e3, 0x03e1f003, 0xfc03e1e0,
+    0xf1a403e1, 0x03f1a403, 0xa003f1ac, 0xc1bc03f9, 0x03c18003, 0xffffff80,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xf181ffdd, 0xf7fd81ff, 0x9fd7ff87,
+    0xbffff7ff, 0x05ffff85, 0xfffde7ff, 0xe1fe05e3, 0x05e1fc05, 0xfc04e1fc,
+    0xf1e404f1, 0x04f9a404, 0xa004f9ac, 0x01bc04f9, 0x04018004, 0xffffff80,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xf181ffdd, 0xffff81ff, 0x8fffff83,
+    0xbfbfffff, 0xc9ffffc9, 0xfff9e7ff, 0xe1ff08e3, 0x08e1ff08, 0xfe0861fe,
+    0x71e40871, 0x0839a408, 0xa00839ac, 0x01bc0879, 0x08018008, 0xffffff80,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xf981ffdd, 0xf7ff81ff, 0x87f5ff83,
+    0x3f9ff7ff, 0xd03fbfd0, 0xfff823ff, 0x21ff1021, 0x1001ff10, 0xfe1001ff,
+    0x01e61001, 0x1001a610, 0xa01001ac, 0x01bc1079, 0x10018010, 0xffffff80,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xf981ffdd, 0xf7ff81ff, 0x87f5ff83,
+    0x1f8ff6ff, 0xe03f9fe0, 0xfff823bf, 0x21ff2021, 0x2001ff20, 0xff2001ff,
+    0x01e62001, 0x2001a620, 0xa62001ae, 0x01be2079, 0x20018020, 0xffffff80,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xfd81ffdd, 0xf5ff81ff, 0x83f4ff81,
+    0x1f87f6ff, 0xe03f87e0, 0x9ff8238f, 0x219f4021, 0x4001bf40, 0xff4001ff,
+    0x01e74001, 0x4001a740, 0xa74001af, 0x01bf4079, 0x40018640, 0xffffff86,
+    0xc1ffffff, 0xffffffff, 0x81ffc5ff, 0xfd81ffdd, 0xf5ff81ff, 0x81f47f81,
+    0x0f83f6ff, 0xe03b83e0, 0x87f82183, 0x21878021, 0x80018780, 0xbf80018f,
+    0x01a78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0xffffffff, 0xff0045ff, 0x01ff005d, 0x1401ff1c, 0xff1401ff,
+    0x01ffb6c1, 0x8039ff80, 0xfff821ff, 0x21ff8021, 0x8001ff80, 0xff8001ff,
+    0x01e7c001, 0xc001e7c0, 0xa7c001ef, 0x01bfe079, 0xe00187e0, 0xffffff87,
+    0xc1ffffff, 0xffffffff, 0xff0045ff, 0x01ff005d, 0x1401ff1c, 0xff9401ff,
+    0x01fff6c1, 0xe039ffc0, 0xfff821ff, 0x21ff8021, 0xc001ff80, 0xffc001ff,
+    0x01e7c001, 0xe001e7e0, 0xe7e001ef, 0x01bff079, 0xf00187f0, 0xffffff87,
+    0xc1ffffff, 0xffffffff, 0xff0045ff, 0x01ff005d, 0x9401ff1c, 0xffd401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ff80, 0xffc001ff,
+    0x01efe001, 0xf001efe0, 0xebf001ef, 0x01fff879, 0xf801cbf8, 0xffffff8b,
+    0xc1ffffff, 0xffffffff, 0xff0045ff, 0x01ff005d, 0x9401ff1c, 0xffd401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ffc0, 0xffe001ff,
+    0x01f7e001, 0xf001f7f0, 0xf3f801ff, 0x01fffc79, 0xfe01d3fc, 0xffffffd1,
+    0xc1ffffff, 0xffffffff, 0xff0045ff, 0x01ff005d, 0x9401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xe001ffc0, 0xffe001ff,
+    0x01e7f001, 0xf801e7f8, 0xe3fc01ef, 0x01fdfe79, 0xff01e1fe, 0xffffffe1,
+    0xc1ffffff, 0xffffffff, 0xff0045ff, 0x01ff005d, 0xd401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xfc39fff0, 0xfffe21ff, 0xe1ff83a1, 0xe071ffc1, 0xfff039ff,
+    0x07e7f00f, 0xfc01e7f8, 0xe1fe01ef, 0x01fdff79, 0xff81e1ff, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x4fffffff, 0x00478000, 0xffffff81, 0x0f81005f, 0x141f811c, 0x80143f80,
+    0xff8036ff, 0x01ff8000, 0x80fbef80, 0x2f8007af, 0x1e1f800f, 0xbc3e1f80,
+    0x3fa47c1f, 0xf03fa4f8, 0xa3e03fad, 0x0fbfe07f, 0x800f8fc0, 0xffffff9f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x7fffffff, 0x007d8000, 0xffffff81, 0xe981007d, 0x15c9811c, 0x80178980,
+    0x098037c9, 0x00398000, 0x80f82980, 0x29800029, 0x00098000, 0xbc000980,
+    0x09a40009, 0x0009a400, 0xa00009ac, 0x09bc0079, 0x00098000, 0xffffff80,
+    0x7fffffff, 0x007d8000, 0xffffff81, 0xf181007d, 0x15f1811c, 0x8017f180,
+    0x718037f1, 0x06798003, 0x80fe7180, 0xf1800c71, 0x38d18018, 0xbc70d180,
+    0xd1a460d1, 0xc191a4e0, 0xa38191ad, 0x91bf81f9, 0x01918701, 0xffffff8e,
+    0x7fffffff, 0x007d8000, 0xffffff81, 0xf981007d, 0x15fd811c, 0x8017ff80,
+    0x7f8037ff, 0x067f8003, 0x80fe6780, 0xe3800c67, 0x38e38018, 0xbc70e380,
+    0xe1a460e1, 0xc1e1a4e0, 0xa381e1ad, 0xa1bf81f9, 0x01a18701, 0xffffff8e,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0xffc5ffff, 0xffffff81, 0xe181ffdd, 0x97f181ff, 0xfe17f98f,
+    0xbff037fd, 0x03bfc003, 0x80ffa780, 0xa18007a3, 0x0f81800f, 0xbc0f8180,
+    0x81a41f81, 0x3f81a41f, 0xa03f81ac, 0x81bc3ff9, 0x7f81807f, 0xffffff80,
+    0xc1ffffff, 0xffc5ffff, 0xffffff81, 0xf181ffdd, 0xd7fd81ff, 0xff17ff8f,
+    0xbffc37ff, 0x03bff003, 0x80fba7c0, 0xe18003a3, 0x07c18007, 0xbc07c180,
+    0xc1a407c1, 0x0fe1a407, 0xa00fe1ac, 0xc1bc0ff9, 0x0fc1800f, 0xffffff80,
+    0xc1ffffff, 0xffc5ffff, 0xffffff81, 0xf981ffdd, 0xd7ff81ff, 0xff97ff8f,
+    0xbffe37ff, 0x03bffc03, 0xe0fbe7f0, 0xe18003e3, 0x03e18003, 0xbc03e180,
+    0xf1a403f1, 0x03f9a403, 0xa003f9ac, 0xc1bc03f9, 0x03c18003, 0xffffff80,
+    0xc1ffffff, 0xffc5ffff, 0xffffff81, 0xfd81ffdd, 0xf7ff81ff, 0xffd7ff8f,
+    0xbfffb7ff, 0x05ffff05, 0xfcfde7fe, 0xe1f805e3, 0x04e1f005, 0xfc04e1e0,
+    0xf1a404f1, 0x04f9a404, 0xa00479ac, 0x01bc0479, 0x04018004, 0xffffff80,
+    0xc1ffffff, 0xffc5bfff, 0xffffff81, 0xff81ffdd, 0xffff81ff, 0xbfffff87,
+    0xbfffffff, 0x88ffffc9, 0xfff8e3ff, 0x61ff0861, 0x0801ff08, 0xfe0801fe,
+    0x01e40801, 0x0801a408, 0xa00801ac, 0x01bc0879, 0x08018008, 0xffffff80,
+    0xc1ffffff, 0xffc59fff, 0xffffff81, 0xff81ffdd, 0xf7ff81ff, 0x9ff5ff87,
+    0x1ffff6ff, 0xd03fffd0, 0xfff823ff, 0x21ff1021, 0x1001ff10, 0xfe1001fe,
+    0x01e61001, 0x1001a410, 0xa01001ac, 0x01bc1079, 0x10018010, 0xffffff80,
+    0xc1ffffff, 0xffc58fff, 0xffffff81, 0xff81ffdd, 0xf5ff81ff, 0x8ff4ff83,
+    0x1f9ff6ff, 0xe03fffe0, 0xfff823ff, 0x21ff2021, 0x2001ff20, 0xff2001ff,
+    0x01e62001, 0x2001a620, 0xa62001ae, 0x01bc2079, 0x20018020, 0xffffff80,
+    0xc1ffffff, 0xffc587ff, 0xffffff81, 0xff81ffdd, 0xf5ff81ff, 0x87f47f83,
+    0x078ff6df, 0xe0399fe0, 0xfff821bf, 0x21ff4021, 0x4001ff40, 0xff4001ff,
+    0x01e74001, 0x4001a740, 0xa74001af, 0x01be4079, 0x40018640, 0xffffff86,
+    0xc1ffffff, 0xffc583ff, 0xffffff81, 0xff81ffdd, 0xf4ff81ff, 0x83f43f81,
+    0x0183f6c7, 0xe03987e0, 0x8ff82187, 0x218f8021, 0x80019f80, 0xbf80019f,
+    0x01a78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045ff80, 0xffffffff, 0x01ff005d, 0x1401ff1c, 0xff9401ff,
+    0x01ffb6c1, 0xc039ffc0, 0xfff821ff, 0x21ff8021, 0x8001ff80, 0xffc001ff,
+    0x01e7c001, 0xc001e7c0, 0xa7e001ef, 0x01bfe079, 0xe00187e0, 0xffffff87,
+    0x41ffffff, 0x0045ffc0, 0xffffffff, 0x01ff005d, 0x9401ff1c, 0xffd401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ff80, 0xffc001ff,
+    0x01e7c001, 0xe001e7e0, 0xe7f001ef, 0x01bff079, 0xf80187f0, 0xffffff87,
+    0x41ffffff, 0x0045ffe0, 0xffffffff, 0x01ff005d, 0x9401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ffc0, 0xffe001ff,
+    0x01efe001, 0xf001eff0, 0xebf801ef, 0x01fff879, 0xfc01cbfc, 0xffffff8b,
+    0x41ffffff, 0x0045fff0, 0xffffffff, 0x01ff005d, 0xd401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ffc0, 0xffe001ff,
+    0x01f7f001, 0xf801f7f0, 0xf3fc01ff, 0x01fffc79, 0xfe01d3fe, 0xffffffd1,
+    0x41ffffff, 0x0045fff8, 0xffffffff, 0x01ff005d, 0xd401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xfc39fff0, 0xfffe21ff, 0xe1ff83a1, 0xe071ffc1, 0xfff03dff,
+    0x07e7f00f, 0xfc01e7f8, 0xe3fe01ef, 0x01fdfe79, 0xff81e1ff, 0xffffffe1,
+    0x41ffffff, 0x0045fffc, 0xffffffff, 0x01ff005d, 0xf401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xfc39fff0, 0xffff21ff, 0xe1ff83e1, 0xe071ffc1, 0xfff03dff,
+    0x07e7f80f, 0xfe01e7fc, 0xe1ff01ef, 0x81fdff79, 0xffc1e1ff, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0xffffffff, 0x17ff81ff, 0x8017ff80,
+    0xff8037ff, 0x01ff8000, 0x80fbef80, 0x3f800faf, 0x3e1f801f, 0xbc7e1f80,
+    0x3fa5fc3f, 0xf03fa7f8, 0xafe07faf, 0x0fbfe07f, 0x800f8fc0, 0xffffff9f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x7fffffff, 0x007d8000, 0x81007d81, 0xffffffff, 0x17ff81ff, 0x8017ff80,
+    0x7f8037ff, 0x0e7f8007, 0x80fe6780, 0xe3800ce7, 0x38e38018, 0xbc70e380,
+    0xe1a461e1, 0xc1e1a4e1, 0xa381e1ad, 0xa1bf83f9, 0x03a18703, 0xffffff8e,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0xffc59fff, 0x81ffc581, 0xffffffff, 0x17ff81ff, 0x8017ff80,
+    0xbf8037ff, 0x07bf8003, 0x80ffa780, 0xa1800fa3, 0x1f81800f, 0xbc1f8180,
+    0x81a43f81, 0x7f81a43f, 0xa07f81ac, 0x81bcfff9, 0xff8180ff, 0xffffff81,
+    0xc1ffffff, 0xffc59fff, 0x81ffc581, 0xffffffff, 0x17ff81ff, 0x8017ff80,
+    0xbf8037ff, 0x03bf8003, 0x80fba780, 0xe18007e3, 0x07c18007, 0xbc07c180,
+    0xe1a40fe1, 0x0fe1a40f, 0xa00fe1ac, 0xc1bc1ff9, 0x1fc1801f, 0xffffff80,
+    0xc1ffffff, 0xffc58fff, 0x81ffc581, 0xffffffff, 0x97ff81ff, 0xfc17ff8f,
+    0xbfe037ff, 0x03ff8003, 0x80fbe780, 0xe18003e3, 0x03e18003, 0xbc03e180,
+    0xf1a403f1, 0x03f9a403, 0xa003f9ac, 0xc1bc03f9, 0x03c18003, 0xffffff80,
+    0xc1ffffff, 0xffc58fff, 0x81ffc581, 0xffffffff, 0xd7ff81ff, 0xff17ff8f,
+    0xbffc37ff, 0x05fff005, 0x80fde3c0, 0xe18005e1, 0x04e18004, 0xbc04e180,
+    0x71a404f1, 0x0479a404, 0xa00479ac, 0x01bc0479, 0x04018004, 0xffffff80,
+    0xc1ffffff, 0xffc587ff, 0x81ffc581, 0xffffffff, 0xffff81ff, 0xffddff8f,
+    0x1fffbeff, 0x083fff08, 0xfcf823fe, 0x21f80821, 0x0801f008, 0xfc0801e0,
+    0x01a40801, 0x0801a408, 0xa00801ac, 0x01bc0879, 0x08018008, 0xffffff80,
+    0xc1ffffff, 0xffc587ff, 0x81ffc581, 0xffffffff, 0xf5ff81ff, 0xfff47f8f,
+    0x07fff6df, 0xd039ffd0, 0xfff821ff, 0x21ff1021, 0x1001ff10, 0xfe1001fe,
+    0x01e41001, 0x1001a410, 0xa01001ac, 0x01bc1079, 0x10018010, 0xffffff80,
+    0xc1ffffff, 0xffc583ff, 0x81ffc581, 0xffffffff, 0xf4ff81ff, 0xfff41f8f,
+    0x01fff6c3, 0xe039ffe0, 0xfff821ff, 0x21ff2021, 0x2001ff20, 0xfe2001ff,
+    0x01e62001, 0x2001a620, 0xa02001ae, 0x01bc2079, 0x20018020, 0xffffff80,
+    0xc1ffffff, 0xffc583ff, 0x81ffc581, 0xffffffff, 0xf47f81ff, 0x9ff40787,
+    0x01fff6c1, 0xe039ffe0, 0xfff821ff, 0x21ff4021, 0x4001ff40, 0xff4001ff,
+    0x01e74001, 0x4001a740, 0xa64001af, 0x01be4079, 0x40018640, 0xffffff86,
+    0xc1ffffff, 0xffc581ff, 0x81ffc581, 0xffffffff, 0xf43f81ff, 0x87f40183,
+    0x018ff6c1, 0xf0399fe0, 0xfff821bf, 0x21ff8021, 0x8001ff80, 0xff8001ff,
+    0x01e78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045ff00, 0xff0045ff, 0x01ffffff, 0x9401ff1c, 0xffd401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0x8001ff80, 0xffc001ff,
+    0x01e7c001, 0xe001e7c0, 0xa7e001af, 0x01bfe079, 0xf00187e0, 0xffffff87,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0x01ffffff, 0xd401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ff80, 0xffc001ff,
+    0x01e7e001, 0xf001e7e0, 0xa7f001ef, 0x01bff079, 0xf80187f8, 0xffffff87,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0x01ffffff, 0xf401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xfc39fff0, 0xfffe21ff, 0xe1ff83a1, 0xc071ffc1, 0xffe039ff,
+    0x07efe00f, 0xf801eff0, 0xebf801ef, 0x01fffc79, 0xfe018bfc, 0xffffff8b,
+    0x41ffffff, 0x0045ffc0, 0xff0045ff, 0x01ffffff, 0xf401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xfc39fff0, 0xffff21ff, 0xe1ff83e1, 0xe071ffc1, 0xffe03dff,
+    0x07f7f00f, 0xfc01f7f8, 0xf3fc01ff, 0x01fffe79, 0xff01d1ff, 0xffffffd1,
+    0x41ffffff, 0x0045ffc0, 0xff0045ff, 0x01ffffff, 0xf401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xfe39fff8, 0xffffa1ff, 0xe1ff83e1, 0xe071ffc1, 0xfff03dff,
+    0x07e7f80f, 0xfe01e7fc, 0xe1fe01ef, 0x81fdff79, 0xffc1e1ff, 0xffffffe1,
+    0x41ffffff, 0x0045ffe0, 0xff0045ff, 0x01ffffff, 0xf401ff1c, 0xfff401ff,
+    0x01fff6c1, 0xfe39fff8, 0xffffa1ff, 0xe1ffc3e1, 0xf071ffe0, 0xfff81dff,
+    0x03e7fc0f, 0xff01e7fe, 0xe1ff81ed, 0xe1fdfff9, 0xfff1e0ff, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81f84781, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0xff8037ff, 0x03ff8000, 0x80ffef80, 0x3f801faf, 0xfe1f807f, 0xbffe3f81,
+    0x3fa7fc3f, 0xf07fa7f8, 0xafe07faf, 0x0fbfe07f, 0x800f8fc0, 0xffffff9f,
+    0x47ffffff, 0xc0478000, 0x81fc4781, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0xff8037ff, 0x01ff8000, 0x80ffef80, 0xaf800faf, 0x7f0f801f, 0xbcff1f80,
+    0x1fa5fe1f, 0xfc1fa7fc, 0xaff81faf, 0x0fbff87f, 0xe00f8ff0, 0xffffff9f,
+    0x49ffffff, 0xf04d8f80, 0x81fe6f81, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0xff8037ff, 0x01ff8000, 0x80fbef80, 0xaf8007ef, 0x1f8f800f, 0xbc3f8f80,
+    0x0fa47f0f, 0xfe0fa4ff, 0xa3fe0fad, 0x0fbffe7f, 0xfc0f8ffc, 0xffffff9f,
+    0x71ffffff, 0xfc758ff0, 0x81ff7581, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0x7f8037ff, 0x0eff8007, 0x80fdf780, 0xf78001f7, 0x07d78003, 0xbc07d780,
+    0x93a40f93, 0x1f93a41f, 0xa03f93ac, 0x11bc7ffb, 0xff11807f, 0xffffff80,
+    0x7fffffff, 0xff7d8ffe, 0x81fffd81, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0x7f8037ff, 0x0e7f8007, 0x80fee780, 0xe3800ce7, 0x39e38018, 0xbc71e380,
+    0xe1a461e1, 0xc3e1a4e3, 0xa383e1ad, 0xa1bf87f9, 0x07a18707, 0xffffff8e,
+    0xffffffff, 0xfffd8fff, 0x81fffd81, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0x7f8037ff, 0x0f7f8007, 0x80ff6780, 0x63800e63, 0x3e61801e, 0xbc7c6180,
+    0x61a47c61, 0xf861a4fc, 0xa3f861ad, 0x41bff879, 0xf04187f0, 0xffffff8f,
+    0xcfffffff, 0xffdd8fff, 0x81fffd81, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0xbf8037ff, 0x07bf8003, 0x80ffa780, 0xa1800fa3, 0x3f81801f, 0xbc3f8180,
+    0x81a47f81, 0xff81a4ff, 0xa1ff81ac, 0x81bffff9, 0xff8183ff, 0xffffff87,
+    0xc1ffffff, 0xffc587ff, 0x81ffc581, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0xbf8037ff, 0x03bf8003, 0x80ffe780, 0xe18007e3, 0x0fe18007, 0xbc0fe180,
+    0xf1a40fe1, 0x1ff1a41f, 0xa01ff1ac, 0xc1bc3ff9, 0x3fc1803f, 0xffffff80,
+    0xc1ffffff, 0xffc587ff, 0x81ffc581, 0xff81ffff, 0x17ffffff, 0x8017ff80,
+    0xbf8037ff, 0x03ff8003, 0x80fbe380, 0xe18003e1, 0x03e18003, 0xbc03f180,
+    0xf9a403f1, 0x03f9a403, 0xa003fdac, 0xc7bc03fd, 0x03c78003, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0xffc583ff, 0x81ffc581, 0xff81ffff, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xe039ffe0, 0xfff821ff, 0x21ff2021, 0x2001ff20, 0xfe2001ff,
+    0x01e62001, 0x2001a620, 0xa02001ac, 0x01bc2079, 0x20018020, 0xffffff80,
+    0xc1ffffff, 0xffc581ff, 0x81ffc581, 0xff81ffff, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xe039ffe0, 0xfff821ff, 0x21ff4021, 0x4001ff40, 0xff4001ff,
+    0x01e74001, 0x4001a740, 0xa64001ae, 0x01be4079, 0x40018640, 0xffffff86,
+    0xc1ffffff, 0xffc581ff, 0x81ffc581, 0xff81ffff, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xf039ffe0, 0xfff821ff, 0x21ff8021, 0x8001ff80, 0xff8001ff,
+    0x01e78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045ff00, 0xff0045ff, 0xffff005d, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0xc001ff80, 0xffc001ff,
+    0x01e7c001, 0xe001e7e0, 0xa7e001af, 0x01bff079, 0xf00187f0, 0xffffff87,
+    0x41ffffff, 0x0045ff00, 0xff0045ff, 0xffff005d, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xfc39fff0, 0xffff21ff, 0xe1ff83a1, 0xc071ffc1, 0xffe03dff,
+    0x07e7e00f, 0xf001e7f0, 0xa7f801ef, 0x01bff879, 0xfc0187fc, 0xffffff87,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0xffff005d, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xfe39fff8, 0xffffa1ff, 0xe1ff83e1, 0xe071ffc1, 0xffe03dff,
+    0x07eff00f, 0xf801eff8, 0xebfc01ef, 0x01fffe79, 0xff018bfe, 0xffffff8b,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0xffff005d, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xfe39fff8, 0xffffe1ff, 0xe1ff83e1, 0xe071ffc1, 0xfff03dff,
+    0x07f7f80f, 0xfc01f7fc, 0xf3fe01ff, 0x81ffff79, 0xffc1d1ff, 0xffffffd1,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0xffff005d, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xff39fff8, 0xffffe1ff, 0xe1ffc3e1, 0xf071ffe0, 0xfff81dff,
+    0x03e7fc07, 0xff01e7fe, 0xe1ff81ef, 0xe1fdfff9, 0xfff1e1ff, 0xffffffe0,
+    0x41ffffff, 0x0045ffc0, 0xff0045ff, 0xffff005d, 0xf401ffff, 0xfff401ff,
+    0x01fff6c1, 0xffb9fffc, 0xffffe1ff, 0xe1ffc3e1, 0xf001ffe0, 0xfff801ff,
+    0x01e7fc01, 0xff81e7ff, 0xe1ffc1ed, 0xe1fdfff9, 0xfff1e0ff, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0xf8478fc0, 0x81fe4781, 0xff81ffff, 0xffff811f, 0x8017ffff,
+    0xff8037ff, 0x0fff8001, 0x80ffef80, 0x3f803fbf, 0xfe3f80ff, 0xbffc3f83,
+    0x7fa7f87f, 0xe0ffa7f0, 0xafc0ffaf, 0x8fbf81ff, 0x038f8f01, 0xffffff9e,
+    0x47ffffff, 0xfc478ff0, 0x81ff6781, 0xff81ffff, 0xffff811f, 0x8017ffff,
+    0xff8037ff, 0x07ff8001, 0x80ffef80, 0x2f801faf, 0xff1f807f, 0xbffe1f81,
+    0x1fa7fc1f, 0xf83fa7f8, 0xaff03faf, 0x0fbfe07f, 0xc00f8fc0, 0xffffff9f,
+    0x49ffffff, 0xfe6f8ff8, 0x81ff6f81, 0xff81ffff, 0xffff811f, 0x8017ffff,
+    0xff8037ff, 0x03ff8000, 0x80ffef80, 0xaf801fef, 0xff8f803f, 0xbdff0f80,
+    0x0fa7ff0f, 0xfe0fa7fe, 0xaffc0faf, 0x0fbffc7f, 0xf80f8ff8, 0xffffff9f,
+    0x71ffffff, 0xff758ffe, 0x81fff781, 0xff81ffff, 0xffff811f, 0x8017ffff,
+    0xff8037ff, 0x01ff8000, 0x80fbf780, 0xf78007f7, 0x1fd7800f, 0xbc3f9380,
+    0x93a47f93, 0xff93a4ff, 0xa3ff11ad, 0x11bfff79, 0xff118fff, 0xffffff9f,
+    0x79ffffff, 0xfffd87ff, 0x81fff581, 0xff81ffff, 0xffff811f, 0x8017ffff,
+    0x7f8037ff, 0x0eff8007, 0x80fce780, 0xe38001e7, 0x03e38001, 0xbc03e180,
+    0xe1a407e1, 0x0fe1a407, 0xa00fe1ac, 0xa1bc1ff9, 0x3fa1801f, 0xffffff80,
+    0xffffffff, 0xfffd87ff, 0x81fffd81, 0xff817fff, 0xffff811f, 0x8017ffff,
+    0x7f8037ff, 0x0f7f8007, 0x80fe6780, 0x61800e63, 0x3c61801c, 0xbc786180,
+    0x61a47861, 0xf061a4f0, 0xa3e061ad, 0x41bfe079, 0xc04187c0, 0xffffff8f,
+    0xdfffffff, 0xfffd87ff, 0x81fffd81, 0xff813fff, 0xffff811f, 0x8017ffff,
+    0xbf8037ff, 0x0fbf8007, 0x80ffa780, 0xa1800fa3, 0x3f81801f, 0xbc7f8180,
+    0x81a47f81, 0xff81a4ff, 0xa3ff81ad, 0x81bffff9, 0xff8187ff, 0xffffff8f,
+    0xcfffffff, 0xffdd87ff, 0x817ffd81, 0xff811fff, 0xffff811f, 0x8017ffff,
+    0xbf8037ff, 0x07ff8003, 0x80ffe380, 0xe1800fe1, 0x1fe1800f, 0xbc1fe180,
+    0xf1a43ff1, 0x7ff9a43f, 0xa07ff9ac, 0xc1bcfff9, 0xffc180ff, 0xffffff81,
+    0xc1ffffff, 0x3fc5807f, 0x811fc581, 0xff810fff, 0xffff811f, 0x8017ffff,
+    0xdf8037ff, 0x03ff8003, 0x80fbe380, 0xe18003e1, 0x03e18003, 0xbc03f180,
+    0xf9a403f1, 0x03f9a403, 0xa003fdac, 0xc7bc03fd, 0x03c78003, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x08458008, 0x81084581, 0x0181085d, 0xffff811c, 0x801c01ff,
+    0x01803ec1, 0x3e39801c, 0x80fe2180, 0x21800f21, 0x0f81800f, 0xbc0f8180,
+    0xc1a40fc1, 0x0fe1a40f, 0xa00fe1ac, 0xc1bc0ff9, 0x0fc1800f, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0xfe4581ff, 0xc1fc4581, 0x01f9f85d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xe039ffe0, 0xfff821ff, 0x21ff2021, 0x2001ff20, 0xfe2001fe,
+    0x01e62001, 0x2001a420, 0xa02001ac, 0x01bc2079, 0x20018020, 0xffffff80,
+    0xc1ffffff, 0xffc581ff, 0xf1ff45c1, 0x01fdfc5d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xf039ffe0, 0xfff821ff, 0x21ff4021, 0x4001ff40, 0xff4001ff,
+    0x01e74001, 0x4001a640, 0xa64001ae, 0x01be4079, 0x40018640, 0xffffff84,
+    0xc1ffffff, 0xffc5f1ff, 0xfdffc5f9, 0x01fffe5d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff8021, 0x8001ff80, 0xff8001ff,
+    0x01e78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xc1ffffff, 0xffc5ffff, 0xffffc5ff, 0x01fffe5d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xfc39fff0, 0xfffe21ff, 0xe1ff83a1, 0x8071ff81, 0xff8039ff,
+    0x07e7c00f, 0xc001a7c0, 0xa7c001af, 0x01bfc079, 0xe00187e0, 0xffffff87,
+    0xc1ffffff, 0x3fc5ff1f, 0xff7fc5ff, 0x01fffe5d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xfe39fff8, 0xffffa1ff, 0xe1ff83e1, 0xc071ff81, 0xffc03dff,
+    0x07e7e00f, 0xe001e7e0, 0xa7f001af, 0x01bff079, 0xf80187f8, 0xffffff87,
+    0xc1ffffff, 0x07c5ff01, 0xff1fc5ff, 0x01ff7e5d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xff39fff8, 0xffffe1ff, 0xe1ff83e1, 0xc071ffc1, 0xffe03dff,
+    0x07e7f00f, 0xf801e7f0, 0xa7f801ef, 0x01bffc79, 0xfe0187fe, 0xffffff87,
+    0x41ffffff, 0x00c5ff00, 0xff07c5ff, 0x01ff3e5d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xffb9fffc, 0xffffe1ff, 0xe1ff83e1, 0xe071ffc0, 0xfff01dff,
+    0x03eff80f, 0xfc01eff8, 0xebfe01ef, 0x81bfff79, 0xff818bff, 0xffffff8b,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0x01ff005d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xfff9fffc, 0xffffe1ff, 0xe1ffc3e1, 0xf001ffe0, 0xfff801ff,
+    0x01f7fc01, 0xff01f7fe, 0xf3ff81ff, 0xe1fdfff9, 0xfff1d1ff, 0xffffffd1,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0x01ff005d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xfff9fffe, 0xffffe1ff, 0xe1ffc3e1, 0xf001ffe0, 0xfff801ff,
+    0x01e7fe01, 0xff81e7ff, 0xe1ffc1ef, 0xe1fdfff9, 0xfff1e1ff, 0xffffffe0,
+    0x41ffffff, 0x0045ff80, 0xff0045ff, 0x01ff005d, 0xfffffffc, 0xfff401ff,
+    0x01fff6c1, 0xfff9fffe, 0xffffe1ff, 0x61ffc1e1, 0xf801ffe0, 0xfffc01ff,
+    0x81e7ff01, 0xffc1e7ff, 0xe1fff1ed, 0xe1fcfff9, 0x7ff1e0ff, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0xfc478ff8, 0x81ff6781, 0xff817fff, 0x17ff811f, 0xffffff80,
+    0xff8037ff, 0xffff800f, 0xbfffaf81, 0x3ff03f3f, 0xf83f81fe, 0xbff07f87,
+    0xffa7e0ff, 0x01ffa780, 0xae03ffaf, 0x8fbc03ff, 0x0f8f8007, 0xffffff80,
+    0x47ffffff, 0xfe4787fc, 0x81ff6781, 0xff817fff, 0x17ff811f, 0xffffff80,
+    0xff8037ff, 0x7fff8007, 0x80ffef80, 0x3f803faf, 0xfe1f80ff, 0xbffc1f83,
+    0x3fa7f83f, 0xe03fa7f0, 0xafc07faf, 0x0fbf807f, 0x000f8f00, 0xffffff9e,
+    0x6bffffff, 0xff6f87fe, 0x81ffef81, 0xff813fff, 0x17ff811f, 0xffffff80,
+    0xff8037ff, 0x1fff8003, 0x80ffef80, 0xaf803faf, 0xff0f80ff, 0xbffe0f83,
+    0x0fa7fe0f, 0xf80fa7fc, 0xaff80faf, 0x0fbff07f, 0xe00f8fe0, 0xffffff9f,
+    0x71ffffff, 0xff7587ff, 0x81fff781, 0xff813fff, 0x17ff811f, 0xffffff80,
+    0xff8037ff, 0x07ff8001, 0x80fff780, 0xf7801ff7, 0xff93807f, 0xbfff9381,
+    0x11a7ff93, 0xff11a7ff, 0xafff11af, 0x11bffe79, 0xfe118ffe, 0xffffff9f,
+    0xf9ffffff, 0xfff587ff, 0x81fff781, 0xff811fff, 0x17ff811f, 0xffffff80,
+    0xff8037ff, 0x01ff8000, 0x80fbe780, 0xe38007e3, 0x1fe1800f, 0xbc3fe180,
+    0xe1a47fe1, 0xffe1a4ff, 0xa3ffe1ad, 0xa1bffff9, 0xffa18fff, 0xffffff9f,
+    0xfdffffff, 0xfffd87ff, 0x817ff581, 0xff811fff, 0x17ff811f, 0xffffff80,
+    0x7f8037ff, 0x0e7f8007, 0x80fc6780, 0x61800063, 0x00618000, 0xbc006180,
+    0x61a40061, 0x0061a400, 0xa00061ac, 0x41bc0079, 0x00418000, 0xffffff80,
+    0xffffffff, 0x7ffd81ff, 0x813ffd81, 0xff810fff, 0x17ff811f, 0xffffff80,
+    0xbf8037ff, 0x0fbf8007, 0x80ffa380, 0xa1800fa1, 0x3f81801f, 0xbc7f8180,
+    0x81a47f81, 0xff81a4ff, 0xa3ff81ad, 0x81bffff9, 0xff8187ff, 0xffffff8f,
+    0xdfffffff, 0x3fdd807f, 0x811ffd81, 0xff810fff, 0x17ff811f, 0xffffff80,
+    0xdf8037ff, 0x0fff8007, 0x80ffe180, 0xe1800fe1, 0x3fe1801f, 0xbc7ff180,
+    0xf9a47ff1, 0xfff9a4ff, 0xa3fffdad, 0xc7bffffd, 0xffc787ff, 0xffffff8f,
+    0xcfffffff, 0x0fdd801f, 0x810ffd81, 0xff8107ff, 0x17ff811f, 0xffffff80,
+    0xcf8037ff, 0x03f98003, 0x80fbe180, 0xe18003e1, 0x03e18003, 0xbc03f180,
+    0xf9a403f1, 0x03f9a403, 0xa003fdac, 0xc7bc03fd, 0x03c78003, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x08458008, 0x81084581, 0x0181085d, 0x1c01811c, 0xffffff80,
+    0x01803ec1, 0x7f39803e, 0x80ffa180, 0xe1800fe1, 0x0ff1800f, 0xbc0ff980,
+    0xffa40ffd, 0x0fffa40f, 0xa00fffac, 0xc7bc0fff, 0x0fc3800f, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0xf845c1fc, 0xf9f845e1, 0x01fdf05d, 0xf401fffc, 0xffffffff,
+    0x01fff6c1, 0xe039ffe0, 0xfff821ff, 0x21ff2021, 0x2001ff20, 0xfe2001fe,
+    0x01e42001, 0x2001a420, 0xa02001ac, 0x01bc2079, 0x20018020, 0xffffff80,
+    0x41ffffff, 0xfe45f1ff, 0xfdfc45f9, 0x01fff85d, 0xf401fffc, 0xffffffff,
+    0x01fff6c1, 0xf839fff0, 0xfff821ff, 0x21ff4021, 0x4001ff40, 0xff4001ff,
+    0x01e64001, 0x4001a640, 0xa64001ae, 0x01bc4079, 0x40018040, 0xffffff80,
+    0xc1ffffff, 0xff45fdff, 0xfffe45fd, 0x01fff85d, 0xf401fffc, 0xffffffff,
+    0x01fff6c1, 0xfe39fff8, 0xffffa1ff, 0xe1ff83e1, 0x8071ff81, 0xff803dff,
+    0x07e7800f, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xc1ffffff, 0xffc5ffff, 0xffff45ff, 0x01fffc5d, 0xf401fffc, 0xffffffff,
+    0x01fff6c1, 0xffb9fffc, 0xffffe1ff, 0xe1ff83e1, 0x8071ff81, 0xffc03dff,
+    0x07e7c00f, 0xc001a7c0, 0xa7e001af, 0x01bfe079, 0xe00187e0, 0xffffff87,
+    0xc1ffffff, 0x7fc5ff7f, 0xffffc5ff, 0x01fffc5d, 0xf401fffc, 0xffffffff,
+    0x01fff6c1, 0xfff9fffe, 0xffffe1ff, 0xe1ff83e1, 0xc071ffc1, 0xffe03dff,
+    0x07e7e00f, 0xf001e7f0, 0xa7f801af, 0x01bff879, 0xfc0187fc, 0xffffff87,
+    0xc1ffffff, 0x3fc5ff1f, 0xff7fc5ff, 0x01fffe5d, 0xf401fffc, 0xffffffff,
+    0x01fff6c1, 0xfff9ffff, 0xffffe1ff, 0xe1ff83e1, 0xe001ffc0, 0xfff001ff,
+    0x01e7f001, 0xfc01e7f8, 0xa7fe01af, 0x01bffe79, 0xff8187ff, 0xffffff87,
+    0xc1ffffff, 0x0fc5ff07, 0xff3fc5ff, 0x01ff7e5d, 0xf401fffc, 0xffffffff,
+    0x81fff6c1, 0xfff9ffff, 0xffffe1ff, 0xe1ffc3e1, 0xf001ffe0, 0xfff801ff,
+    0x01effc01, 0xff01effe, 0xebff81ef, 0xe1bffff9, 0xfff18bff, 0xffffff8b,
+    0xc1ffffff, 0x07c5ff01, 0xff1fc5ff, 0x01ff7e5d, 0xf401fffc, 0xffffffff,
+    0xc1fff6c1, 0xfff9ffff, 0xffffe1ff, 0x61ffc1e1, 0xf001ffe0, 0xfffc01ff,
+    0x01f7fe01, 0xff81f7ff, 0xf3ffe1ff, 0xe1fdfff9, 0xfff1d1ff, 0xffffffd1,
+    0x41ffffff, 0x01c5ff80, 0xff0fc5ff, 0x01ff3e5d, 0xf401fffc, 0xffffffff,
+    0xe1fff6c1, 0xfff9ffff, 0xffffe1ff, 0x61ffc1e1, 0xf801fff0, 0xfffe01ff,
+    0xc1e7ff01, 0xffe1e7ff, 0xe1fff9ed, 0xe1fdfff9, 0xfff1e0ff, 0xffffffe0,
+    0x41ffffff, 0x00c5ff80, 0xff07c5ff, 0x01ff3e5d, 0xf401fffc, 0xffffffff,
+    0xf1fff6c1, 0xfff9ffff, 0xffffe1ff, 0x21ffc1e1, 0xfc01fff0, 0xffff01ff,
+    0xe1e7ff81, 0xfff9e7ff, 0xe1ffffed, 0xe3fcffff, 0x7ff1e0ff, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0xfe4787fc, 0x81ff6781, 0xff813fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xffffbfff, 0x3ff03e3f, 0xe03f81f8, 0xbf807f87,
+    0xffa600ff, 0x03ffa401, 0xa003ffac, 0x8fbc07ff, 0x1f8f800f, 0xffffff80,
+    0x47ffffff, 0xff6787fe, 0x81ffe781, 0xff811fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xffffafff, 0x3ff03f3f, 0xf83f81fc, 0xbfe03f87,
+    0x7fa7c07f, 0x00ffa700, 0xa000ffae, 0x8fbc01ff, 0x038f8001, 0xffffff80,
+    0x6bffffff, 0xff6f87fe, 0x817fef81, 0xff811fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xffffefff, 0x2ff03faf, 0xfe0f81ff, 0xbffc0f87,
+    0x0fa7f80f, 0xe00fa7f0, 0xafc00faf, 0x0fbf807f, 0x000f8f00, 0xffffff9e,
+    0x71ffffff, 0xfff787ff, 0x817ff781, 0xff811fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xfffff7ff, 0xb3f03ff7, 0xff9380ff, 0xbfff1187,
+    0x11a7ff11, 0xfe11a7fe, 0xaffc11af, 0x11bffc79, 0xf8118ff8, 0xffffff9f,
+    0xf1ffffff, 0xfff581ff, 0x813ff781, 0xff810fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xffffe7ff, 0xe1f03fe3, 0xffe180ff, 0xbfffe183,
+    0xe1a7ffe1, 0xffe1a7ff, 0xafffe1af, 0xa1bffff9, 0xffa18fff, 0xffffff9f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xdfffffff, 0x1fdd801f, 0x810ffd81, 0xff8107ff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1f81fe1, 0x7fe1c03f, 0xbcfff180,
+    0xf9a5fff1, 0xfffda7ff, 0xaffffdaf, 0xc7bfffff, 0xffc787ff, 0xffffff8f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x08458008, 0x81084581, 0x0181085d, 0x1c01811c, 0x801c0180,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fe0fe1, 0x0ff1f80f, 0xbc0ff9e0,
+    0xffa40ffd, 0x0fffa40f, 0xa00fffac, 0xc7bc0fff, 0x0fc3800f, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0xfc45f9fc, 0xfdf845fd, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ff43e1, 0x4071ff41, 0xfe403dff,
+    0x07e6400f, 0x4001a640, 0xa04001ac, 0x01bc4079, 0x40018040, 0xffffff80,
+    0x41ffffff, 0xfe45fdff, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ff83e1, 0x8071ff81, 0xff803dff,
+    0x07e7800f, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0xc1ffffff, 0xff45ffff, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ff83e1, 0xc071ff80, 0xffc01dff,
+    0x03e7c007, 0xe001a7e0, 0xa7e001af, 0x01bff079, 0xf00187f0, 0xffffff87,
+    0xc1ffffff, 0xffc5ff7f, 0xfffe45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ff83e1, 0xe001ffc0, 0xffe001ff,
+    0x01e7f001, 0xf801a7f8, 0xa7fc01af, 0x01bffe79, 0xff0187fe, 0xffffff87,
+    0xc1ffffff, 0x7fc5ff3f, 0xff7f45ff, 0x01fffc5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x61ffc1e1, 0xf001ffe0, 0xfff801ff,
+    0x01e7fc01, 0xff01e7fe, 0xa7ff81af, 0xe1bffff9, 0xfff187ff, 0xffffff87,
+    0xc1ffffff, 0x3fc5ff1f, 0xff7f45ff, 0x01fffc5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffc1e1, 0xf801ffe0, 0xfffc01ff,
+    0x81effe01, 0xffc1efff, 0xabffe1ef, 0xe1bffff9, 0xfff18bff, 0xffffff8b,
+    0xc1ffffff, 0x1fc5ff07, 0xff3fc5ff, 0x01ff7c5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffc1e1, 0xfc01fff0, 0xfffe01ff,
+    0xe1f7ff81, 0xfff1f7ff, 0xf1fffdff, 0xe3fdffff, 0xfff1d1ff, 0xffffffd1,
+    0xc1ffffff, 0x0fc5ff03, 0xff1fc5ff, 0x01ff7e5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffe0e1, 0xfe01fff8, 0xffff81ff,
+    0xf9e7ffe1, 0xffffe7ff, 0xe1ffffed, 0xe3fcffff, 0xfff1e0ff, 0xffffffe0,
+    0xc1ffffff, 0x07c5ff81, 0xff1fc5ff, 0x01ff7e5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffe0e1, 0xff01fff8, 0xffffc1ff,
+    0xffe7fff1, 0xffffe5ff, 0xe0ffffed, 0xe3fcffff, 0x7ff1e07f, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0xff4787fe, 0x817fe781, 0xff811fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xfffe3fff, 0x3fc0003f, 0x007f8000, 0xbc00ff80,
+    0xffa401ff, 0x07ffa403, 0xa00fffac, 0x8fbc1fff, 0x7f8f803f, 0xffffff80,
+    0x47ffffff, 0xff6787fe, 0x817fe781, 0xff811fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xffff3fff, 0x3fc0003f, 0x003f8000, 0xbc007f80,
+    0xffa400ff, 0x01ffa401, 0xa003ffac, 0x8fbc07ff, 0x0f8f800f, 0xffffff80,
+    0x6bffffff, 0xff6f83ff, 0x813fef81, 0xff810fff, 0x17ff811f, 0x8017ff80,
+    0xffffffff, 0xffffffff, 0xffffafff, 0x2fe03e2f, 0xe00f81f8, 0xbf800f87,
+    0x0fa6000f, 0x000fa400, 0xa0000fac, 0x0fbc007f, 0x000f8000, 0xffffff80,
+    0x71ffffff, 0x7ff781ff, 0x813ff781, 0xff810fff, 0x17ff811f, 0xc015ff80,
+    0xffffffff, 0xffffffff, 0xfffff7ff, 0x31e03fb3, 0xfe1181ff, 0xbffc1187,
+    0x11a7f811, 0xe011a7f0, 0xafc011af, 0x11bf8079, 0x00118f00, 0xffffff9e,
+    0xf1ffffff, 0x1ff5803f, 0x810ff781, 0xff8107ff, 0x15ff811f, 0xe014ff80,
+    0xffffffff, 0xffffffff, 0xffffe3ff, 0xe1f03fe1, 0xffe181ff, 0xbfffe187,
+    0xe1a7ffe1, 0xffe1a7ff, 0xafffe1af, 0xa1bffff9, 0xffa18fff, 0xffffff9f,
+    0x71ffffff, 0x00758000, 0x81007781, 0x7f81007f, 0x167f811c, 0xf0177f80,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1f03fe1, 0xffe181ff, 0xbfffe187,
+    0xf1a7ffe1, 0xfff1a7ff, 0xaffff1af, 0xc1bffff9, 0xffc18fff, 0xffffff9f,
+    0xc1ffffff, 0x0fc5801f, 0x810fc781, 0x8f8107df, 0x179f811f, 0xf817bf80,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1f83fe1, 0xffe180ff, 0xbffff183,
+    0xf9a7fff1, 0xfff9a7ff, 0xaffffdaf, 0xc7bffffd, 0xffc78fff, 0xffffff9f,
+    0xddffffff, 0x0fdd801f, 0x810ff581, 0xf18107fd, 0x17e7811f, 0xfc17df80,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1f81fe1, 0xffe1c07f, 0xbffff180,
+    0xfda7fff9, 0xfffda7ff, 0xafffffaf, 0xc7bfffff, 0xffc787ff, 0xffffff8f,
+    0xddffffff, 0x03dd8003, 0x8103f581, 0xf18103fd, 0x17e1811f, 0xfe1fcfe0,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fc1fe1, 0x7ff1e03f, 0xbcfff980,
+    0xffa5fffd, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc387ff, 0xffffff8f,
+    0x41ffffff, 0x04458004, 0x81044581, 0x7181047d, 0x1ce1c11c, 0xff1dc7f8,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fc0fe1, 0x1ff1f01f, 0xbc3ff980,
+    0xffa43ffd, 0x7fffa47f, 0xa0ffffac, 0xc7bcffff, 0xffc381ff, 0xffffff81,
+    0x41ffffff, 0x08458008, 0x81084581, 0x01e1085d, 0x1c01f91c, 0xff9c03fe,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fe0fe1, 0x0ff1f80f, 0xbc0ffde0,
+    0xffa40fff, 0x0fffa40f, 0xa00fffac, 0xc7bc0fff, 0x0fc3800f, 0xffffff80,
+    0x41ffffff, 0x1045f010, 0xfd1045f9, 0x01ff105d, 0x9c01ff1c, 0xffdc01ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fe17e1, 0x13f1fc17, 0xfc13fdf0,
+    0xffa411ff, 0x10ffa411, 0xa010ffac, 0x07bc107f, 0x10038010, 0xffffff80,
+    0x41ffffff, 0xe045f9e0, 0xfde045f9, 0x01ffe05d, 0xf401fffc, 0xfffc01ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ff27e1, 0x21f1fe23, 0xfc20fdfc,
+    0x3fa4207f, 0x201fa420, 0xa0200fac, 0x03bc207f, 0x20018020, 0xffffff80,
+    0x41ffffff, 0xf845fdfc, 0xfff845fd, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ff43e1, 0x4071ff41, 0xfe403dfe,
+    0x07a4400f, 0x4001a440, 0xa04001ac, 0x01bc4079, 0x40018040, 0xffffff80,
+    0x41ffffff, 0xfc45fffe, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ff83e1, 0x8001ff80, 0xff8001ff,
+    0x01e78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0x41ffffff, 0xfe45ffff, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x61ff81e1, 0xc001ffc0, 0xffe001ff,
+    0x01e7e001, 0xf001a7f0, 0xa7f801af, 0x01bff879, 0xfc0187fc, 0xffffff87,
+    0xc1ffffff, 0xfe45ffff, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffc1e1, 0xf001ffe0, 0xfff801ff,
+    0x01e7fc01, 0xff01a7fe, 0xa7ff81af, 0xe1bffff9, 0xfff187ff, 0xffffff87,
+    0xc1ffffff, 0x7f45ff7f, 0xfffe45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffc0e1, 0xf801fff0, 0xfffe01ff,
+    0xc1e7ff01, 0xffe1e7ff, 0xa7fff9af, 0xe1bffff9, 0xfff187ff, 0xffffff87,
+    0xc1ffffff, 0x3fc5ff3f, 0xff7e45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffe0e1, 0xfe01fff8, 0xffff81ff,
+    0xf9efffe1, 0xffffefff, 0xabffffef, 0xe3bfffff, 0xfff18bff, 0xffffff89,
+    0xc1ffffff, 0x3fc5ff1f, 0xff7f45ff, 0x01fffc5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffe061, 0xff01fffc, 0xffffe1ff,
+    0xfff7fff9, 0xfffff7ff, 0xf1ffffff, 0xe3fdffff, 0xfff1d1ff, 0xffffff90,
+    0xc1ffffff, 0x1fc5ff0f, 0xff3f45ff, 0x01ff7c5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21fff061, 0xffc1fffe, 0xfffff9ff,
+    0xffe7ffff, 0xffffe7ff, 0xe1ffffed, 0xe3fcffff, 0x7ff1e0ff, 0xffffffe0,
+    0xc1ffffff, 0x0fc5ff07, 0xff3fc5ff, 0x01ff7c5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21fff021, 0xffe1ffff, 0xffffffff,
+    0xffe7ffff, 0xffffe5ff, 0xe0ffffed, 0xe3fc7fff, 0x3ff1e07f, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0xff6783fe, 0x813fe781, 0xff810fff, 0x17ff811f, 0x8015ff80,
+    0xffffffff, 0xffffffff, 0x80f83fff, 0x3f80003f, 0x007f8000, 0xbc00ff80,
+    0xffa403ff, 0x0fffa407, 0xa03fffac, 0x8fbc7fff, 0xff8f80ff, 0xffffff83,
+    0x47ffffff, 0x7f6781fe, 0x813fe781, 0xff810fff, 0x17ff811f, 0x8015ff80,
+    0xffffffff, 0xffffffff, 0x80f83fff, 0x3f80003f, 0x007f8000, 0xbc00ff80,
+    0xffa401ff, 0x07ffa403, 0xa00fffac, 0x8fbc1fff, 0x7f8f803f, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x71ffffff, 0x0c758018, 0x810c7781, 0x7f81067f, 0x177f811e, 0xfe177ff0,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe181ffe1, 0xffe1bfff, 0xffffe1ff,
+    0xf1a7fff1, 0xfff1a7ff, 0xaffff9af, 0xc1bffff9, 0xffc18fff, 0xffffff9f,
+    0xc1ffffff, 0x0fc5801f, 0x810fc781, 0x9f8107df, 0x17bfc11f, 0xff17bff8,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe180ffe1, 0xffe18fff, 0xfffff1ff,
+    0xf9a7fff9, 0xfffda7ff, 0xafffffaf, 0xc7bfffff, 0xffc78fff, 0xffffff9f,
+    0xc1ffffff, 0x0fc5800f, 0x8107c781, 0xcf8107df, 0x17dfe11f, 0xff1fbffc,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1c07fe1, 0xfff183ff, 0xbffff99f,
+    0xffa7fffd, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc78fff, 0xffffff9f,
+    0xddffffff, 0x03dd8003, 0x8103f581, 0xf3e103fd, 0x1feff91f, 0xff9fdffe,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1e03fe1, 0xfff180ff, 0xbffff983,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc387ff, 0xffffff8f,
+    0x5dffffff, 0x045d8004, 0xe10475c1, 0xf1f904fd, 0x1de7fd1c, 0xff9ddfff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1f01fe1, 0x7ff1803f, 0xbcfffd80,
+    0xffa5ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc387ff, 0xffffff8f,
+    0x41ffffff, 0x0845f008, 0xfd0845f9, 0x71ff087d, 0x9ce3ff1c, 0xffddcfff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1f80fe1, 0x0ff1800f, 0xbc0ffd80,
+    0xffa40fff, 0x0fffa40f, 0xa00fffac, 0xc7bc0fff, 0x0fc3800f, 0xffffff80,
+    0x41ffffff, 0x1045f010, 0xfd1045f9, 0x01ff905d, 0xdc01ff9c, 0xffdc0fff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fc17e1, 0x11f1e013, 0xbc10fd80,
+    0x3fa4107f, 0x101fa410, 0xa0100fac, 0x03bc107f, 0x10018010, 0xffffff80,
+    0x41ffffff, 0xe045f9e0, 0xfde045fd, 0x01ffe05d, 0xfc01fffc, 0xfffc07ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fe23e1, 0x2001f820, 0xbc2001e0,
+    0x01a42001, 0x2001a420, 0xa02001ac, 0x01bc2079, 0x20018020, 0xffffff80,
+    0x41ffffff, 0xf845fdf8, 0xfff045fd, 0x01fff05d, 0xf401fffc, 0xfffc07ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ff41e1, 0x4001fe40, 0xfc4001fc,
+    0x01a44001, 0x4001a440, 0xa04001ac, 0x01bc4079, 0x40018040, 0xffffff80,
+    0x41ffffff, 0xf845fffc, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ff80e1, 0x8001ff80, 0xff8001ff,
+    0x01a78001, 0x8001a780, 0xa78001af, 0x01bf8079, 0x80018780, 0xffffff87,
+    0x41ffffff, 0xfc45fffe, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffc061, 0xf001ffe0, 0xfff801ff,
+    0x01e7fc01, 0xff01a7fe, 0xa7ff81af, 0xe1bffff9, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xfe45ffff, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21ffe021, 0xfe01fff8, 0xffff81ff,
+    0xf9e7ffe1, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0x7e45ff7f, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0x21fff021, 0xffc1fffe, 0xfffff9ff,
+    0xffe7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0xc1ffffff, 0x7f45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xa1fff821, 0xfff9ffff, 0xffffffff,
+    0xffefffff, 0xffffefff, 0xabffffaf, 0xe3bfffff, 0xfff189ff, 0xffffff89,
+    0xc1ffffff, 0x3f45ff1f, 0xff7e45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fffc21, 0xffffffff, 0xffffffff,
+    0xfff7ffff, 0xfffff7ff, 0xf1fffffd, 0xe3fdffff, 0xfff190ff, 0xffffff90,
+    0xc1ffffff, 0x3fc5ff1f, 0xff7e45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1fffe21, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffe5ff, 0xe0ffffed, 0xe3fcffff, 0x3ff9e07f, 0xffffffe0,
+    0xc1ffffff, 0x1fc5ff0f, 0xff3f45ff, 0x01ff7c5d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xffffffff, 0xffffe1ff, 0xe1ffff21, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffe5ff, 0xe07fffec, 0xe3fc7fff, 0x1ff9e03f, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x7f6781fe, 0x813fe781, 0xff810fff, 0x17ff811f, 0x8014ff80,
+    0x3f8036ff, 0x003f8000, 0xffffff80, 0x3f80003f, 0x00ff8000, 0xbc03ff80,
+    0xffa40fff, 0xffffa43f, 0xa3ffffac, 0x8fbfffff, 0xff0f8fff, 0xffffffbf,
+    0x47ffffff, 0x0f67801e, 0x8107e781, 0xff8103ff, 0x14ff811d, 0x80147f80,
+    0x1f8036ff, 0x003f8000, 0xffffff80, 0x3f80003f, 0x007f8000, 0xbc01ff80,
+    0xffa403ff, 0x1fffa40f, 0xa07fffac, 0x8fbcffff, 0xff8f83ff, 0xffffff87,
+    0x4bffffff, 0x004f8000, 0x81004f81, 0x0f81005f, 0x140f811c, 0x80140f80,
+    0x0f8036cf, 0x003f8000, 0xffffff80, 0x3f80003f, 0x007f8000, 0xbc00ff80,
+    0xffa401ff, 0x07ffa403, 0xa00fffac, 0x8fbc1fff, 0x7f8f803f, 0xffffff80,
+    0x51ffffff, 0x00558000, 0x81005581, 0x1181005d, 0x1411811c, 0x80141180,
+    0x178036d3, 0x003f8000, 0xffffff80, 0x3f80003f, 0x003f8000, 0xbc007f80,
+    0xffa4007f, 0x00ffa400, 0xa001ffac, 0x97bc01ff, 0x03978003, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x71ffffff, 0x0e75801c, 0x810e7781, 0x7f81067f, 0x177ff11f, 0xff177dfc,
+    0xf1fffff9, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffe1ffff, 0xfffff1ff,
+    0xf9a7fff1, 0xfff9a7ff, 0xaffffdaf, 0xc7bffffd, 0xffc78fff, 0xffffff9f,
+    0xc1ffffff, 0x0fc5801f, 0x810fc781, 0xbfe107df, 0x17bff91f, 0xff9fbffe,
+    0xf9ffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xfff1ffff, 0xfffff9ff,
+    0xffa7fffd, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc78fff, 0xffffff9f,
+    0xc1ffffff, 0x0fc5800f, 0xc107c781, 0xdff107df, 0x179ffd1f, 0xff9fbffe,
+    0xfdffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xfff1ffff, 0xfffffdff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc38fff, 0xffffff9f,
+    0xd9ffffff, 0x03dd8003, 0xe103f7c1, 0xeff903ff, 0x1fdffd1f, 0xff9fbfff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xfff9ffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc38fff, 0xffffff9f,
+    0x5dffffff, 0x04dd8004, 0xe104f5c1, 0xf7f904fd, 0x1deffd1d, 0xff9ddfff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xfff9ffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc387ff, 0xffffff8f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0xfc45fffc, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xfc45fffe, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xfe45ff7f, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0x7e45ff7f, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffffffff, 0xffffffff,
+    0xffefffff, 0xffffefff, 0xabffffaf, 0xe3bdffff, 0xfff189ff, 0xffffff89,
+    0xc1ffffff, 0x7f45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffffffff, 0xffffffff,
+    0xfff7ffff, 0xfffff7ff, 0xf1fffffd, 0xe3bcffff, 0x7ff990ff, 0xffffff90,
+    0xc1ffffff, 0x3f45ff1f, 0xff7e45ff, 0x01fff85d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffe5ff, 0xe0ffffec, 0xe3fc7fff, 0x1ff9e03f, 0xffffffe0,
+    0xc1ffffff, 0x3fc5ff1f, 0xff7e45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0xffffffff, 0xfff9ffff, 0xffffffff, 0xe1ffffe1, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffe5ff, 0xe07fffec, 0xe1fc3fff, 0x0ff9e01f, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x0f67801e, 0x8107e781, 0xff8103ff, 0x14ff811d, 0x80147f80,
+    0x1f8036ff, 0x003f8000, 0x80f83f80, 0x3fffffff, 0x03ff8000, 0xbc3fff80,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0f9fff, 0xffffffff,
+    0x47ffffff, 0x00678000, 0x81006781, 0x3f81007f, 0x143f811c, 0x80141f80,
+    0x0f8036df, 0x003f8000, 0x80f83f80, 0x3fffffff, 0x01ff8000, 0xbc0fff80,
+    0xffa47fff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff8f9fff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0x81004f81, 0x0f81005f, 0x140f811c, 0x80140f80,
+    0x0f8036cf, 0x003f8000, 0x80f83f80, 0x3fffffff, 0x00ff8000, 0xbc03ff80,
+    0xffa40fff, 0xffffa43f, 0xa3ffffac, 0x8fbfffff, 0xff8f8fff, 0xffffffbf,
+    0x51ffffff, 0x00558000, 0x81005581, 0x1181005d, 0x1413811c, 0x80141380,
+    0x178036d7, 0x003f8000, 0x80f83f80, 0x3fffffff, 0x007f8000, 0xbc00ff80,
+    0xffa401ff, 0x07ffa403, 0xa00fffac, 0x97bc1fff, 0x7f97803f, 0xffffff80,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x71ffffff, 0x0e75801e, 0xc10e7581, 0x79f1077d, 0x1779f91f, 0xff9f71fe,
+    0xe1fffff1, 0xfff9bfff, 0xffffe181, 0xe1ffffff, 0xfff1ffff, 0xfffff9ff,
+    0xffa7fffd, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc78fff, 0xffffffbf,
+    0xc1ffffff, 0x0fc5800f, 0xe107c7c1, 0xbff907ff, 0x17bffd1f, 0xff9fbdff,
+    0xf1fffff9, 0xfff98fff, 0xffffe180, 0xe1ffffff, 0xfff9ffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc78fff, 0xffffff9f,
+    0xc1ffffff, 0x07c58007, 0xe107c7c1, 0x9ff907df, 0x1fbffd1f, 0xff9fbfff,
+    0xf19ffffd, 0x7ff983ff, 0xffffe1c0, 0xe1ffffff, 0xfffdffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc38fff, 0xffffff9f,
+    0xc1ffffff, 0x03c58003, 0xe103c7c1, 0xcff903df, 0x1fdffd1f, 0x8f9fbfbf,
+    0xf983ffff, 0x3ff980ff, 0xffffe1e0, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc38fff, 0xffffff9f,
+    0xddffffff, 0x04dd8004, 0x8104f781, 0xef8105ff, 0x1ddf811d, 0x801dbf80,
+    0xf9803fff, 0x1ff9803f, 0xffffe1f0, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffe38fff, 0xffffff9f,
+    0x5dffffff, 0x085d8008, 0x81087581, 0xe78108ff, 0x1dcf811c, 0x801d9f80,
+    0xf9803fff, 0x0ff9800f, 0xffffe1f8, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffe387ff, 0xffffff8f,
+    0x41ffffff, 0x10458010, 0x81104581, 0x0381105d, 0x140f811c, 0x80141f80,
+    0xf98037ff, 0x17f9e013, 0xffffe1fc, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc3bfffff, 0xffe187ff, 0xffffff8f,
+    0x41ffffff, 0x20458020, 0x81204581, 0x0181205d, 0x3403813c, 0x80340f80,
+    0xf9e036ff, 0x23f9f820, 0xffffe1fe, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xc3bfffff, 0xffe187ff, 0xffffff8f,
+    0x41ffffff, 0x40458040, 0x81404581, 0x01c1405d, 0x5401e15c, 0xf85401f0,
+    0x01fc76c1, 0x41f9fe40, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff8f,
+    0x41ffffff, 0x8045ff80, 0xff8045ff, 0x01ff805d, 0x9401ff9c, 0xff9401ff,
+    0x01ffb6c1, 0x80f9ff80, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xf845fffc, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fff6c1, 0xc079ffe0, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xfc45fffc, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fffec1, 0xe039fff8, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xfc45ff7e, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fffec1, 0xf039fffe, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff987ff, 0xffffff87,
+    0x41ffffff, 0x7e45ff7f, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0x81ffffc1, 0xf839ffff, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffefffff, 0xffffafff, 0xa9ffffaf, 0xe3bdffff, 0xfff989ff, 0xffffff88,
+    0x41ffffff, 0x7e45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff403ff,
+    0xe1ffffff, 0xfc39ffff, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xfff7ffff, 0xfffff5ff, 0xb0fffffd, 0xe1bc7fff, 0x3ff9907f, 0xffffff90,
+    0xc1ffffff, 0x3e45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff403ff,
+    0xf9ffffff, 0xfe39ffff, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffe7ffff, 0xffffe5ff, 0xe07fffec, 0xe1fc3fff, 0x0ff9e01f, 0xffffffe0,
+    0xc1ffffff, 0x3f45ff1f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff403ff,
+    0xffffffff, 0xff39ffff, 0xffffe1ff, 0xe1ffffff, 0xffffffff, 0xffffffff,
+    0xffe5ffff, 0x7fffe4ff, 0xe01fffec, 0xe1fc0fff, 0x01f9e007, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00678000, 0x81006781, 0x7f81007f, 0x143f811c, 0x80143f80,
+    0x0f8036df, 0x003f8000, 0x80f83f80, 0xff80003f, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0f9fff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x1f81005f, 0x141f811c, 0x80141f80,
+    0x0f8036cf, 0x003f8000, 0x80f83f80, 0xff80003f, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0f9fff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0x81004f81, 0x0f81005f, 0x140f811c, 0x80140f80,
+    0x0f8036cf, 0x003f8000, 0x80f83f80, 0xff80003f, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff8f9fff, 0xffffffff,
+    0x51ffffff, 0x00558000, 0x81005581, 0x1381005f, 0x1413811c, 0x80141780,
+    0x178036d7, 0x003f8000, 0x80f83f80, 0xff80003f, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x97bfffff, 0xff979fff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x71ffffff, 0x0e75801e, 0xe10f75c1, 0x71f9077d, 0x1771fd1f, 0xbf9f71ff,
+    0xe187ffe1, 0x3ff981ff, 0xffffe1f0, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc78fff, 0xffffffbf,
+    0xd1ffffff, 0x0fd5800f, 0xe107f5c1, 0xbdf907fd, 0x17b9fd1f, 0x8f9fb9bf,
+    0xe183fff1, 0x3ff980ff, 0xffffe1f8, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc38fff, 0xffffffbf,
+    0xc1ffffff, 0x07c58007, 0xe107c7c1, 0x9fb903df, 0x1fbf9d1f, 0x839fbd87,
+    0xf180fff9, 0x1ff9c07f, 0xffffe1f8, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc38fff, 0xffffff9f,
+    0xc1ffffff, 0x03c58003, 0x8103c781, 0xdf8103df, 0x1f9f811f, 0x801fbf80,
+    0xf1803ff9, 0x1ff9e03f, 0xffffe1fc, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffc38fff, 0xffffff9f,
+    0xc1ffffff, 0x04c58004, 0x8105c781, 0xcf8105df, 0x1ddf811d, 0x801dbf80,
+    0xf1803ffd, 0x0ff9f01f, 0xffffe1fc, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc7bfffff, 0xffe38fff, 0xffffff9f,
+    0x5dffffff, 0x085d8008, 0x8108f781, 0xef8108ff, 0x1ddf811c, 0x801dbf80,
+    0xf9e03fff, 0x0ff9f80f, 0xffffe1fe, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc3bfffff, 0xffe18fff, 0xffffff9f,
+    0x5dffffff, 0x105d8010, 0x81107581, 0xe781107f, 0x14cf811c, 0xe0159f80,
+    0xf9f037ff, 0x17f9fc17, 0xffffe1fe, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc3bfffff, 0xffe187ff, 0xffffff8f,
+    0x41ffffff, 0x20458020, 0x81204581, 0x03c1205d, 0x340fe13c, 0xf8341ff0,
+    0xf9fc37ff, 0x27f9fe23, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff8f,
+    0x41ffffff, 0x4045f040, 0xf94045f1, 0x03f9405d, 0x5407fd5c, 0xfe541ffc,
+    0xf9fe76ff, 0x43f9ff41, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff8f,
+    0x41ffffff, 0x8045ff80, 0xff8045ff, 0x01ff805d, 0x9403ff9c, 0xff940fff,
+    0xf9ffb6ff, 0x83f9ff80, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xf845fffc, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff403ff,
+    0x79fff6cf, 0x81f9ffc0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff87,
+    0x41ffffff, 0xf845fffc, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fff6c1, 0xc1f9ffe0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff987ff, 0xffffff87,
+    0x41ffffff, 0xfc45fffe, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fff6c1, 0xc0f9fff0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe1bfffff, 0xfff987ff, 0xffffff87,
+    0x41ffffff, 0x7c45ff7e, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fffec1, 0xe0f9fff8, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffefffff, 0xffffafff, 0xa9ffffad, 0xe1bcffff, 0x7ff988ff, 0xffffff88,
+    0x41ffffff, 0x7e45ff7f, 0xfffc45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0x01fffec1, 0xe079fffc, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xfff7ffff, 0xfffff5ff, 0xb07fffbc, 0xe1bc3fff, 0x0ff9901f, 0xffffff90,
+    0x41ffffff, 0x7e45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0x01fffec1, 0xf079fffe, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffe5ffff, 0x3fffe4ff, 0xe01fffec, 0xe1fc07ff, 0x00f9e003, 0xffffffe0,
+    0xc1ffffff, 0x3e45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0x01ffffc1, 0xf039ffff, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffe5ffff, 0x1fffe47f, 0xe007ffec, 0x01fc01ff, 0x0001e000, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00678000, 0x81006781, 0x3f81007f, 0x143f811c, 0x80141f80,
+    0x0f8036df, 0x003f8000, 0xfff83ff0, 0xfffffe3f, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0f9fff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x1f81005f, 0x141f811c, 0x80140f80,
+    0x0f8036cf, 0x003f8000, 0xfff83ff0, 0xffffff3f, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0f9fff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0x81004f81, 0x0f81005f, 0x140f811c, 0x80140f80,
+    0x0f8036cf, 0x003f8000, 0xfffe3ff8, 0xffffffbf, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff8f9fff, 0xffffffff,
+    0x51ffffff, 0x00578000, 0xe10057c1, 0x13f9005f, 0x1417bd1c, 0x839c178f,
+    0x1781fed7, 0x1f3f807e, 0xffffbff8, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x97bfffff, 0xff979fff, 0xffffffff,
+    0x61ffffff, 0x0e65800c, 0xe10665c1, 0x61f9067d, 0x1763bd1f, 0x839f638f,
+    0xe781ffe7, 0x1fffc07f, 0xfffffff8, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xa7bfffff, 0xffa79fff, 0xffffffff,
+    0x71ffffff, 0x0f75800e, 0xe10775c1, 0x71f9077d, 0x1771bd1f, 0x839f618f,
+    0xe381ffe1, 0x1fffe07f, 0xffffeffc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc79fff, 0xffffffff,
+    0xd1ffffff, 0x0ff5800f, 0x8107f581, 0xb98107fd, 0x1fb9811f, 0x801fb180,
+    0xe1803ff1, 0x1ff9e03f, 0xffffe3fc, 0xffffffef, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc38fff, 0xffffffbf,
+    0xc1ffffff, 0x07c58007, 0x8103c581, 0xbd8103dd, 0x1fbd811f, 0x801fb980,
+    0xe1c03ff1, 0x1ff9f03f, 0xffffe1fc, 0xffffffe7, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc38fff, 0xffffffbf,
+    0xc1ffffff, 0x03c58003, 0x8103c781, 0xdf8103df, 0x1fbf811f, 0x801fbd80,
+    0xf1e03ff9, 0x0ff9f81f, 0xffffe1fe, 0xffffffe3, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffe38fff, 0xffffffbf,
+    0xc1ffffff, 0x05c58004, 0x8105c781, 0xdf8105df, 0x1ddf811d, 0xc01dbd80,
+    0xf1f03ff9, 0x0ff9f80f, 0xffffe1fe, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc3bfffff, 0xffe18fff, 0xffffff9f,
+    0x59ffffff, 0x08dd8008, 0x8108f781, 0xef8108ff, 0x1ddf811d, 0xe01dbfc0,
+    0xf1f83ffd, 0x0ff9fc0f, 0xffffe1fe, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xc3bfffff, 0xffe18fff, 0xffffff9f,
+    0x5dffffff, 0x105d8010, 0x81107781, 0xefc110ff, 0x15dfe11c, 0xf815bff0,
+    0xf1fc37fd, 0x17f9fe17, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xe3bfffff, 0xfff18fff, 0xffffff9f,
+    0x4dffffff, 0x205dc020, 0xe12075e1, 0xe7f1207f, 0x34cff93c, 0xfc359ff8,
+    0xf9fe37ff, 0x27f9fe23, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff8f,
+    0x41ffffff, 0x4045f840, 0xfd4045fd, 0x07fd405d, 0x540fff5c, 0xfe541ffe,
+    0xf9ff77ff, 0x47f9ff43, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xe3bfffff, 0xfff187ff, 0xffffff8f,
+    0x41ffffff, 0x8045ff80, 0xff8045ff, 0x03ff805d, 0x940fff9c, 0xff941fff,
+    0xf9ffb6ff, 0x83f9ff81, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe3bfffff, 0xfff987ff, 0xffffff8f,
+    0x41ffffff, 0xf045fff0, 0xffe045ff, 0x03ffe05d, 0xd407fffc, 0xffd41fff,
+    0xf9fff6ff, 0x83f9ff80, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe1bfffff, 0xfff987ff, 0xffffff87,
+    0x41ffffff, 0xf845fffc, 0xfff845ff, 0x01fff05d, 0xf403fffc, 0xfff40fff,
+    0xf9fff6ff, 0x83f9ffc0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe1bfffff, 0xfff987ff, 0xffffff87,
+    0x41ffffff, 0xfc45fffc, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff403ff,
+    0x79fff6df, 0xc1f9ffe0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xe1bfffff, 0xfff987ff, 0xffffff87,
+    0x41ffffff, 0xfc45ff7e, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fff6c1, 0xc1f9ffe0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffafffff, 0xffffadff, 0xa87fffac, 0xe1bc3fff, 0x0ff9881f, 0xffffff88,
+    0x41ffffff, 0x7c45ff7e, 0xfff845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fff6c1, 0xc1f9fff0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xfff5ffff, 0x1fffb47f, 0xb007ffbc, 0x01bc01ff, 0x00019000, 0xffffff90,
+    0x41ffffff, 0x7e45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0x01fffec1, 0xe0f9fff8, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffe4ffff, 0x03ffe41f, 0xe0007fec, 0x01fc007f, 0x0001e000, 0xffffffe0,
+    0x41ffffff, 0x7e45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0x01fffec1, 0xe0f9fff8, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffe47fff, 0x007fe407, 0xe00007ec, 0x01fc0079, 0x0001e000, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00678000, 0x81006781, 0x3f81007f, 0x141f811c, 0x80141f80,
+    0x0f8036cf, 0x003fc000, 0xfffe3ff8, 0xffffffbf, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0fbfff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0xe1004781, 0x1ff1005f, 0x140fbd1c, 0x83940f8e,
+    0x0f81f6cf, 0x1c3fc078, 0xffff3ff8, 0xffffffbf, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0fbfff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0xe1004fc1, 0x0ff9005f, 0x140fbd1c, 0x839c0f8f,
+    0x0f81fecf, 0x1f3fe07e, 0xffffbffc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0fbfff, 0xffffffff,
+    0x53ffffff, 0x00578000, 0xe10057c1, 0x17f9005f, 0x1617bd1e, 0x839f178f,
+    0x9781ffd7, 0x1fbfe07f, 0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0x97bfffff, 0xff979fff, 0xffffffff,
+    0x61ffffff, 0x0e65800e, 0xe10665c1, 0x63b9067d, 0x17639d1f, 0x839f6387,
+    0xe780ffe7, 0x1ffff07f, 0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xa7bfffff, 0xffa79fff, 0xffffffff,
+    0x71ffffff, 0x0f75800f, 0x81077581, 0x7181077d, 0x1761811f, 0x801f6380,
+    0xe7c03fe3, 0x1ffff03f, 0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc39fff, 0xffffffff,
+    0xf1ffffff, 0x07f5800f, 0x8107f581, 0xb98107fd, 0x1fb1811f, 0x801fb180,
+    0xe3e03fe1, 0x1ffff83f, 0xffffeffe, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc39fff, 0xffffffff,
+    0xc1ffffff, 0x03c58007, 0x8103c581, 0xbd8103dd, 0x1fb9811f, 0xc01fb180,
+    0xe1e03ff1, 0x0ff9f81f, 0xffffe7fe, 0xffffffef, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc39fff, 0xffffffff,
+    0xc1ffffff, 0x03c58003, 0x8103c781, 0x9f8103df, 0x1fbd811f, 0xe01fb980,
+    0xe1f03ff1, 0x0ff9fc1f, 0xffffe3fe, 0xffffffef, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc3bfffff, 0xffe18fff, 0xffffffbf,
+    0xc1ffffff, 0x05c58005, 0x8105c781, 0xdf8105df, 0x1d9f811d, 0xf01dbdc0,
+    0xf1f83ff9, 0x0ff9fc0f, 0xffffe1fe, 0xffffffe7, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xc3bfffff, 0xffe18fff, 0xffffffbf,
+    0xc1ffffff, 0x08c58008, 0x8108c781, 0xcfc108df, 0x1ddfe11d, 0xf81dbdf0,
+    0xf1fc3ff9, 0x0ff9fe0f, 0xffffe1ff, 0xffffffe7, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xe3bfffff, 0xfff18fff, 0xffffff9f,
+    0x5dffffff, 0x105d8010, 0xe11077c1, 0xefe110ff, 0x15dff11c, 0xfc15bff8,
+    0xf1fc37f9, 0x17f9fe17, 0xffffe1ff, 0xffffffe3, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffaf, 0xe3bfffff, 0xfff18fff, 0xffffff9f,
+    0x5dffffff, 0x205df020, 0xf92077f1, 0xeff9207f, 0x34dffd3c, 0xfe35bffc,
+    0xf1fe37fd, 0x27f9ff27, 0xffffe1ff, 0xffffffe3, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xe3bfffff, 0xfff18fff, 0xffffff9f,
+    0x4dffffff, 0x405dfc40, 0xff4075fd, 0x67ff407f, 0x54cfff5c, 0xff559ffe,
+    0xf1ff77fd, 0x47f9ff43, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xe1bfffff, 0xfff987ff, 0xffffff8f,
+    0x41ffffff, 0x8045ff80, 0xff8045ff, 0x07ff805d, 0x940fff9c, 0xff941fff,
+    0xf9ffb7ff, 0x87f9ff83, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xe1bfffff, 0xfff987ff, 0xffffff8f,
+    0x41ffffff, 0xe045ffe0, 0xffe045ff, 0x03ffc05d, 0xd40fffdc, 0xffd41fff,
+    0xf9ffb6ff, 0x83f9ff81, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xf1bfffff, 0xfffd87ff, 0xffffff87,
+    0x41ffffff, 0xf845fffc, 0xfff845ff, 0x03fff05d, 0xf407fffc, 0xfff41fff,
+    0xf9fff6ff, 0x83f9ffc1, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xf1bfffff, 0xfffd87ff, 0xffffff87,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x7e45ff3f, 0xff7c45ff, 0x01fff85d, 0xf401fffc, 0xfff401ff,
+    0x01fff6c1, 0xc0f9fff0, 0xffffe1ff, 0xffffffe1, 0xffffffff, 0xffffffff,
+    0x01e40001, 0x0001e400, 0xe00001ec, 0x01fc0079, 0x0001e000, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0xe10047c1, 0x1ff9005f, 0x141fbd1c, 0x83941f8f,
+    0x0f81f6cf, 0x1e3fe078, 0xffff3ffc, 0xffffffbf, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0x0fbfffff, 0xfe1fffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0xe10047c1, 0x0ff9005f, 0x140fbd1c, 0x839c0f8f,
+    0x0f81fecf, 0x1f3fe07e, 0xffffbffc, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0fffff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0xe1004fc1, 0x0ff9005f, 0x140f9d1c, 0x839c0f8f,
+    0x0f80fecf, 0x1fbff07f, 0xffffbffc, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0x8fbfffff, 0xff0fbfff, 0xffffffff,
+    0x53ffffff, 0x0c57800c, 0x81065781, 0x1781065f, 0x1717811e, 0x801f1780,
+    0x97c03fd7, 0x1ffff03f, 0xfffffffc, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0x97bfffff, 0xff97bfff, 0xffffffff,
+    0x61ffffff, 0x0e65800e, 0x81066581, 0x6381077f, 0x1763811f, 0x801f6780,
+    0xe7e03fe7, 0x1ffff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xa7bfffff, 0xffa7bfff, 0xffffffff,
+    0x71ffffff, 0x0f75800f, 0x81077581, 0x6181077d, 0x1f63811f, 0x801f6380,
+    0xe7e03fe7, 0x1ffff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc3bfff, 0xffffffff,
+    0xf1ffffff, 0x07f58007, 0x8107f581, 0xb18107fd, 0x1fb1811f, 0xc01fb380,
+    0xe7f03fe3, 0x0ffff81f, 0xffffeffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xc7bfffff, 0xffc39fff, 0xffffffff,
+    0xc1ffffff, 0x03c58003, 0x8103c581, 0xb98103fd, 0x1fb9811f, 0xe01fb1c0,
+    0xe3f03ff1, 0x0ffffc1f, 0xffffeffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xc3bfffff, 0xffe19fff, 0xffffffff,
+    0xc1ffffff, 0x03c58003, 0x8103c581, 0x9d8103dd, 0x1fb9811f, 0xf01fb9e0,
+    0xe1f83ff1, 0x0ffbfc0f, 0xffffe7fe, 0xffffffef, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xc3bfffff, 0xffe19fff, 0xffffffff,
+    0xc1ffffff, 0x05c58005, 0x8105c781, 0xdfc105df, 0x1dbde11d, 0xf81db9f0,
+    0xe1fc3ff1, 0x0ff9fe0f, 0xffffe3ff, 0xffffffef, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xe3bfffff, 0xfff19fff, 0xffffffff,
+    0xc1ffffff, 0x08c58008, 0xc108c781, 0xdfe109df, 0x1ddff11d, 0xf81dbdf8,
+    0xf1fc3ff9, 0x0ff9fe0f, 0xffffe3ff, 0xffffffef, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xe3bfffff, 0xfff18fff, 0xffffffbf,
+    0x41ffffff, 0x1045e010, 0xf110c7e1, 0xcff110df, 0x15dff91c, 0xfc15bdfc,
+    0xf1fe37f9, 0x17f9fe17, 0xffffe1ff, 0xffffffe7, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xe1bfffff, 0xfff98fff, 0xffffffbf,
+    0x5dffffff, 0x205df820, 0xf92077f9, 0xeffd20ff, 0x35dffd3c, 0xfe35bffe,
+    0xf1fe37f9, 0x27f9ff27, 0xffffe1ff, 0xffffffe7, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xe1bfffff, 0xfff98fff, 0xffffff9f,
+    0x5dffffff, 0x405dfe40, 0xff4077ff, 0xefff407f, 0x54dfff5c, 0xff55bfff,
+    0xf1ff77fd, 0x47f9ff43, 0xffffe1ff, 0xffffffe7, 0xffffffff, 0xbfffffff,
+    0xffffffff, 0xffffa7ff, 0xbfffffaf, 0xf1bfffff, 0xfffd8fff, 0xffffff9f,
+    0x41ffffff, 0x8045ff80, 0xff8045ff, 0x07ff805f, 0x940fff9c, 0xff941fff,
+    0xf1ffb7fd, 0x87f9ff83, 0xffffe1ff, 0xffffffe3, 0xffffffff, 0xbfffffbf,
+    0xffffffff, 0xffffa7ff, 0xafffffaf, 0xf1bfffff, 0xfffd87ff, 0xffffff8f,
+    0x41ffffff, 0xc045ffe0, 0xffc045ff, 0x07ffc05f, 0xd40fffdc, 0xff941fff,
+    0xf1ffb7fd, 0x87f9ff83, 0xffffe1ff, 0xffffffe3, 0xffffffff, 0xbfffff9f,
+    0xffffffff, 0xffffa7ff, 0xafffffaf, 0xf1bfffff, 0xffff87ff, 0xffffff8f,
+    0x41ffffff, 0xf045fff8, 0xfff045ff, 0x03ffe05d, 0xf40ffffc, 0xffd41fff,
+    0xf9fff6ff, 0x83f9ff81, 0xffffe1ff, 0xffbfffe3, 0xffff9fff, 0xbfffff8f,
+    0xffffffff, 0xffffa7ff, 0xa7ffffaf, 0xf1bfffff, 0xffff87ff, 0xffffff87,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x00458800, 0x89004589, 0x0189005d, 0x1401891c, 0x88140188,
+    0x018836c1, 0x00398800, 0x88f82188, 0x21880021, 0x00018800, 0xbc000188,
+    0x01ffffff, 0x0001bc00, 0xb80001bc, 0x01bc0079, 0x00018800, 0xffffff88,
+    0x41ffffff, 0x00459000, 0x91004591, 0x0191005d, 0x1401911c, 0x90140190,
+    0x019036c1, 0x00399000, 0x90f82190, 0x21900021, 0x00019000, 0xbc000190,
+    0x01ffffff, 0x0001bc00, 0xb80001bc, 0x01bc0079, 0x00019000, 0xffffff90,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x7c45ff3e, 0xff7845ff, 0x01fff05d, 0xf401fffc, 0xfff401ff,
+    0x01fff6c1, 0x0039ff80, 0xfef821ff, 0x21fc0021, 0x0001f800, 0xfc0001f0,
+    0x01ffffff, 0x0001e400, 0xe00001ec, 0x01fc0079, 0x0001e000, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0xe10047c1, 0x1ff9005f, 0x141fbd1c, 0x839c0f8f,
+    0x0fc1fecf, 0x1f3ff07e, 0xffffbffc, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0x0fbfffff, 0xfc1fffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0xe10047c1, 0x0fb9005f, 0x140f9d1c, 0x839c0f87,
+    0x0fc0fecf, 0x1f3ff07f, 0xffffbffc, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0x0fbfffff, 0xfe0fffff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0x81004f81, 0x0f81005f, 0x160f811e, 0x801f0f80,
+    0x8fe03fcf, 0x1fbff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0x8fbfffff, 0xff0fffff, 0xffffffff,
+    0x53ffffff, 0x0e57800c, 0x81065781, 0x1781065f, 0x1717811f, 0x801f1780,
+    0xd7e03fd7, 0x1ffff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0x97bfffff, 0xff17ffff, 0xffffffff,
+    0x61ffffff, 0x0e65800e, 0x81066781, 0x6381077f, 0x1763811f, 0xc01f6780,
+    0xe7f03fe7, 0x1ffff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xa7bfffff, 0xffa3ffff, 0xffffffff,
+    0x71ffffff, 0x0f75800f, 0x81077581, 0x6181077d, 0x1f63811f, 0xe01f6380,
+    0xe7f03fe7, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xc7bfffff, 0xffc3ffff, 0xffffffff,
+    0xf1ffffff, 0x07f58007, 0x8107f581, 0xb18103fd, 0x1fb1811f, 0xe01fa3c0,
+    0xe7f83fe3, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xc3bfffff, 0xffc1bfff, 0xffffffff,
+    0xc1ffffff, 0x03c58003, 0x8103c581, 0xb98103fd, 0x1fb1c11f, 0xf01fb1e0,
+    0xe7f83fe3, 0x0ffffc1f, 0xffffeffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xc3bfffff, 0xffe1bfff, 0xffffffff,
+    0xc1ffffff, 0x03c58003, 0x8103c581, 0xb9c103dd, 0x1fb9e11f, 0xf81fb1f0,
+    0xe3fc3ff1, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xe3bfffff, 0xfff1bfff, 0xffffffff,
+    0xc1ffffff, 0x05c58005, 0xc105c581, 0xdde105dd, 0x1db9f11d, 0xf81db9f0,
+    0xe1fc3ff1, 0x0ffbfe0f, 0xffffe7ff, 0xffffffef, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xe1bfffff, 0xfff19fff, 0xffffffff,
+    0xc1ffffff, 0x08c5c008, 0xe108c7e1, 0xdff109df, 0x1d9df91d, 0xfc1db9f8,
+    0xe1fe3ff1, 0x0ff9fe0f, 0xffffe7ff, 0xffffffef, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xe1bfffff, 0xfff99fff, 0xffffffff,
+    0x41ffffff, 0x10c5f010, 0xf910c7f1, 0xdff910df, 0x15dffd1d, 0xfe15bdfc,
+    0xf1fe37f9, 0x17f9ff17, 0xffffe3ff, 0xffffffef, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xf1bfffff, 0xfffd9fff, 0xffffffff,
+    0x59ffffff, 0x205df820, 0xfd2077fd, 0xeffd20ff, 0x35dfff3c, 0xfe35bdfe,
+    0xf1ff37f9, 0x27f9ff27, 0xffffe3ff, 0xffffffef, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xf1bfffff, 0xfffd8fff, 0xffffffbf,
+    0x5dffffff, 0x405dfe40, 0xff4077ff, 0xefff407f, 0x54dfff5c, 0xff55bdff,
+    0xf1ff77f9, 0x47f9ff47, 0xffffe1ff, 0xffffffe7, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xf1bfffff, 0xffff8fff, 0xffffff9f,
+    0x4dffffff, 0x805dff80, 0xff8077ff, 0xefff807f, 0x94dfff9c, 0xff95bfff,
+    0xf1ffb7f9, 0x87f9ff83, 0xffffe1ff, 0xffffffe7, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xf9bfffff, 0xffff8fff, 0xffffff9f,
+    0x41ffffff, 0xc045ffc0, 0xffc045ff, 0x07ffc05f, 0x940fffdc, 0xff941fff,
+    0xf1ffb7fd, 0x87f9ff83, 0xffffe1ff, 0xffbfffe7, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffffff, 0xbfffffaf, 0xf9bfffff, 0xffff87ff, 0xffffff8f,
+    0x41ffffff, 0xf045fff0, 0xffe045ff, 0x07ffe05f, 0xd40ffffc, 0xffd41fff,
+    0xf1bff7fd, 0x87f9bf83, 0x9fffe19f, 0xff8fffe7, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffffff, 0xafffffaf, 0xf9bfffff, 0xffff87ff, 0xffffff87,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x00458800, 0x89004589, 0x0189005d, 0x1401891c, 0x88140188,
+    0x018836c1, 0x00398800, 0x88f82188, 0x21880021, 0x00018800, 0xbc000188,
+    0xffbc0001, 0x0001ffff, 0xb80001bc, 0x01bc0079, 0x00018800, 0xffffff88,
+    0x41ffffff, 0x00459000, 0x91004591, 0x0191005d, 0x1401911c, 0x90140190,
+    0x019036c1, 0x00399000, 0x90f82190, 0x21900021, 0x00019000, 0xbc000190,
+    0xffbc0001, 0x0001ffff, 0xbc0001bc, 0x01bc0079, 0x00019000, 0xffffff90,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045ff00, 0xff0045ff, 0x01ff005d, 0x1401ff1c, 0xfe1401fe,
+    0x01fc36c1, 0x0039fc00, 0xf8f821f8, 0x21f00021, 0x0001f000, 0xfc0001e0,
+    0xffe40001, 0x0001ffff, 0xe00001ec, 0x01fc0079, 0x0001e000, 0xffffffe0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x1f81005f, 0x141f811c, 0x801c0f80,
+    0x0fe03ecf, 0x1f3ff83e, 0xffffbffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0x1fbfffff, 0xf83ffffe, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x0f81005f, 0x140f811c, 0x801c0f80,
+    0x0fe03fcf, 0x1fbff83f, 0xffffbffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0x0fbfffff, 0xfc1fffff, 0xffffffff,
+    0x4bffffff, 0x0c4f800c, 0x81064f81, 0x0f81065f, 0x170f811e, 0xc01f0f80,
+    0x8fe03fcf, 0x1fbff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0x0fbfffff, 0xfe0fffff, 0xffffffff,
+    0x53ffffff, 0x0e57800c, 0x81065781, 0x1781065f, 0x1717811f, 0xc01f1780,
+    0xd7f03fd7, 0x1ffff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0x97bfffff, 0xff17ffff, 0xffffffff,
+    0x61ffffff, 0x0e67800e, 0x81076781, 0x6381077f, 0x1f67811f, 0xe01f6780,
+    0xe7f03fe7, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xa7bfffff, 0xffa3ffff, 0xffffffff,
+    0x71ffffff, 0x0775800f, 0x81076581, 0x6381077d, 0x1f63811f, 0xe01f63c0,
+    0xe7f83fe7, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xc3bfffff, 0xffc1ffff, 0xffffffff,
+    0xf1ffffff, 0x07f58007, 0x8107f581, 0xb18103fd, 0x1fb3c11f, 0xf01fa3e0,
+    0xe7f83fe7, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xc3bfffff, 0xffe1ffff, 0xffffffff,
+    0xd1ffffff, 0x03d58003, 0x8103f581, 0xb1c103fd, 0x1fb1e11f, 0xf81fb3f0,
+    0xe7fc3fe3, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xe1bfffff, 0xfff1ffff, 0xffffffff,
+    0xc1ffffff, 0x03c58003, 0xc103c581, 0xb9e103dd, 0x1fb9e11f, 0xf81fb1f0,
+    0xe3fc3ff3, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xe1bfffff, 0xfff9ffff, 0xffffffff,
+    0xc1ffffff, 0x05c58005, 0xe105c5c1, 0x9df105dd, 0x1db9f11d, 0xfc1db1f8,
+    0xe3fc3ff1, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xf1bfffff, 0xfffdffff, 0xffffffff,
+    0xc1ffffff, 0x08c5e008, 0xf109c5e1, 0xddf909dd, 0x1dbdf91d, 0xfc1db9fc,
+    0xe1fe3ff1, 0x0ffbfe0f, 0xffffe7ff, 0xffffffef, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xf1bfffff, 0xffffbfff, 0xffffffff,
+    0x41ffffff, 0x10c5f010, 0xf910c7f9, 0xdffd10df, 0x15ddfd1d, 0xfe15b9fc,
+    0xe1fe37f1, 0x17f9ff17, 0xffffe7ff, 0xffffffef, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xf9bfffff, 0xffffbfff, 0xffffffff,
+    0x41ffffff, 0x2045fc20, 0xfd20c7fd, 0xcfff20df, 0x35dfff3c, 0xfe35bdfe,
+    0xf1ff37f9, 0x27f9ff27, 0xffffe3ff, 0xffffffef, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xf9bfffff, 0xffff9fff, 0xffffffff,
+    0x59ffffff, 0x405dfe40, 0xff4077ff, 0xefff40ff, 0x55dfff5c, 0xff55bdff,
+    0xf1ff77f9, 0x47f9ff47, 0xffffe3ff, 0xffffffef, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xfdbfffff, 0xffff9fff, 0xffffffff,
+    0x5dffffff, 0x805dff80, 0xff8077ff, 0xefff807f, 0x94dfff9c, 0xff95bdff,
+    0xf1ffb7f9, 0x87f9ff83, 0xffffe3ff, 0xffbfffef, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xfdbfffff, 0xffff8fff, 0xffffffbf,
+    0x4dffffff, 0xc05dffc0, 0xffc077ff, 0x6fffc07f, 0x94dfff9c, 0xff95bfff,
+    0xf1ffb7f9, 0x87f9ff83, 0x9fffe1bf, 0xff9fffe7, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xffbfffff, 0xffff8fff, 0xffffff9f,
+    0x41ffffff, 0xe045ffe0, 0xffe045ff, 0x07bfe05f, 0xd40fbfdc, 0x9fd41fbf,
+    0xf19fb7fd, 0x87f99f83, 0x8fffe18f, 0xff8fffe7, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffff, 0xffbfffff, 0xffff87ff, 0xffffff8f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x00459000, 0x91004591, 0x0191005d, 0x1401911c, 0x90140190,
+    0x019036c1, 0x00399000, 0x90f82190, 0x21900021, 0x00019000, 0xbc000190,
+    0x01bc0001, 0xffffbc00, 0xbfffffff, 0xffbfffff, 0x7fff91ff, 0xffffff90,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045fe00, 0xff0045ff, 0x01fd005d, 0x1401fd1c, 0xf81401fc,
+    0x01f836c1, 0x0039f800, 0xf0f821f0, 0x21f00021, 0x0001e000, 0xfc0001e0,
+    0x01e40001, 0xffffe400, 0xe00001ff, 0x01fc0079, 0x0001e000, 0xfffffff0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x1f81005f, 0x140f811c, 0xc01c0f80,
+    0x0fe03ecf, 0x1fbff83f, 0xffffbffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0x3fbfffff, 0x00fffff8, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x0f81005f, 0x160f811e, 0xc01f0f80,
+    0x8ff03fcf, 0x1fbff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffff,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0x1fbfffff, 0xc03ffffc, 0xffffffff,
+    0x4bffffff, 0x0c4f800c, 0x81064f81, 0x0f81065f, 0x170f811e, 0xe01f0f80,
+    0x8ff03fcf, 0x1ffffc3f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0x0fbfffff, 0xf00ffffe, 0xffffffff,
+    0x53ffffff, 0x0e57800e, 0x81065781, 0x1781065f, 0x1717811f, 0xe01f17c0,
+    0xd7f03fd7, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0x17bfffff, 0xfc13ffff, 0xffffffff,
+    0x63ffffff, 0x0e67800e, 0x81076781, 0x6381077f, 0x1f67811f, 0xf01f67c0,
+    0xe7f83fe7, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xa3bfffff, 0xff21ffff, 0xffffffff,
+    0x71ffffff, 0x07658007, 0x81076581, 0x6381077f, 0x1f63c11f, 0xf01f67e0,
+    0xe7f83fe7, 0x0ffffc1f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xc1bfffff, 0xffc1ffff, 0xffffffff,
+    0xf1ffffff, 0x07f58007, 0x8103f581, 0xb1c103fd, 0x1fa3e11f, 0xf81fa3f0,
+    0xe7fc3fe7, 0x0ffffe1f, 0xffffffff, 0xffffffff, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xe1bfffff, 0xfff1ffff, 0xffffffff,
+    0xd1ffffff, 0x03d58003, 0xc103f581, 0xb1c103fd, 0x1fb1e11f, 0xf81fb3f0,
+    0xe7fc3fe3, 0x0ffffe0f, 0xffffffff, 0xffffffff, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xf1bfffff, 0xfffdffff, 0xffffffff,
+    0xc1ffffff, 0x03c58003, 0xe103c5c1, 0xb9e103dd, 0x1fb1f11f, 0xfc1fb3f8,
+    0xe7fc3fe3, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xf9bfffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x05c5c005, 0xf105c5e1, 0x99f105dd, 0x1db9f91d, 0xfc1db1f8,
+    0xe3fe3ff1, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xfdbfffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x08c5f008, 0xf909c5f1, 0xddf909dd, 0x1db9fd1d, 0xfe1db9fc,
+    0xe3fe3ff1, 0x0fffff0f, 0xffffefff, 0xffffffff, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xffbfffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x10c5f810, 0xfd10c5f9, 0xddfd10dd, 0x159dfd1d, 0xfe15b9fe,
+    0xe1fe37f1, 0x17fbff17, 0xffffe7ff, 0xffffffef, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xffbfffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x2045fc20, 0xff20c7fd, 0xdfff20df, 0x35ddff3c, 0xff35b9fe,
+    0xe1ff37f1, 0x27fbff27, 0xffffe7ff, 0xffbfffef, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xffbfffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x4045fe40, 0xff4047ff, 0xcfff40df, 0x55dfff5c, 0xff55bdff,
+    0xf1ff77f9, 0x47f9ff47, 0xffffe7ff, 0xffbfffef, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xffbfffff, 0xffffffff, 0xffffffff,
+    0x5dffffff, 0x805dff80, 0xff8077ff, 0xefff807f, 0x94dfff9c, 0xff95bdff,
+    0xf1ffb7f9, 0x87f9ff87, 0xbfffe3bf, 0xff9fffef, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xffbfffff, 0xffffbfff, 0xffffffff,
+    0x5dffffff, 0xc05dffc0, 0xffc077ff, 0xefff807f, 0x94dfff9c, 0xff95bdff,
+    0xf1bfb7f9, 0x87f9bf83, 0x9fffe39f, 0xff8fffef, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xffbfffff, 0xffff9fff, 0xffffffff,
+    0x4dffffff, 0xe05dbfe0, 0xbfe077bf, 0x6f9fc07f, 0xd4df9fdc, 0x9fd5bf9f,
+    0xf18fb7f9, 0x87f98f83, 0x8fffe38f, 0xff87ffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xffffffbf, 0xffbfffff, 0xffff8fff, 0xffffff9f,
+    0x41ffffff, 0xe04587e0, 0x87e04587, 0x0787c05f, 0xd40f87dc, 0x87d41f87,
+    0xf187b7f9, 0x87f98783, 0x87ffe187, 0xff87ffe7, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffb7ff, 0xffffffbf, 0xffbfffff, 0xffff87ff, 0xffffff87,
+    0x41ffffff, 0x00458800, 0x89004589, 0x0789005f, 0x140f891c, 0x88141f88,
+    0xf18837f9, 0x07f98803, 0x88ffe188, 0xff881fe7, 0x7fff883f, 0xbcffff88,
+    0xffbdffff, 0xffffbfff, 0xffffffbf, 0xffbfffff, 0xffff8bff, 0xffffff89,
+    0x41ffffff, 0x00459000, 0x91004591, 0x0191005d, 0x1401911c, 0x90140190,
+    0x019036c1, 0x00399000, 0x90f82190, 0xff900067, 0x07ff9001, 0xbc1fff90,
+    0xffbc7fff, 0xffffbdff, 0xffffffbf, 0xffbfffff, 0x7fff91ff, 0xffffff90,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045fc00, 0xfd0045fd, 0x01f9005d, 0x1401f91c, 0xf81401f8,
+    0x01f036c1, 0x0039f000, 0xf0f821f0, 0x21e00021, 0x0001e000, 0xfc0001e0,
+    0x01e40001, 0x0001e400, 0xffffffec, 0x01fc0079, 0x0001f000, 0xfffffff8,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x1f81005f, 0x140f811c, 0xc01c0f80,
+    0x0ff03fcf, 0x1fbff83f, 0xffffbffe, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x0f81005f, 0x160f811e, 0xc01f0f80,
+    0x8ff03fcf, 0x1fbff83f, 0xfffffffe, 0xffffffff, 0xffffffff, 0xbfffffbf,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xf1ffffff, 0x07f58007, 0x8103f581, 0xb1c103fd, 0x1fa3e11f, 0xf81fa3f0,
+    0xe7fc3fe7, 0x0ffffe0f, 0xffffffff, 0xffffffff, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xd1ffffff, 0x03f58003, 0xc103f5c1, 0xb1e103fd, 0x1fb3f11f, 0xf81fa3f8,
+    0xe7fc3fe7, 0x0ffffe0f, 0xffffffff, 0xffffffff, 0xffffffff, 0xbfffff9f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x03c5c003, 0xe103c5e1, 0xb9f103fd, 0x1fb1f91f, 0xfc1fb3f8,
+    0xe7fe3fe3, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x05c5e005, 0xf105c5f1, 0xb9f905dd, 0x1db9f91d, 0xfc1db1fc,
+    0xe7fe3ff3, 0x0ffffe0f, 0xffffefff, 0xffffffff, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x09c5f008, 0xf909c5f9, 0xddf909dd, 0x1db9fd1d, 0xfe1db1fc,
+    0xe3fe3ff1, 0x0fffff0f, 0xffffefff, 0xffffffff, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x10c5f810, 0xfd10c5fd, 0xddfd11dd, 0x15b9ff1d, 0xfe15b9fe,
+    0xe3ff37f1, 0x17ffff17, 0xffffefff, 0xffbfffff, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x20c5fc20, 0xff20c7ff, 0xdfff20df, 0x35ddff3d, 0xff35b9fe,
+    0xe1ff37f1, 0x27fbff27, 0xffffe7ff, 0xffbfffef, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x4045fe40, 0xff4047ff, 0xdfff40df, 0x55ddff5c, 0xff55b9ff,
+    0xe1ff77f1, 0x47fbff47, 0xbfffe7ff, 0xff9fffef, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x59ffffff, 0x805dff80, 0xff8077ff, 0xefff80ff, 0x95dfff9c, 0xff95bdff,
+    0xf1ffb7f9, 0x87f9bf87, 0x9fffe7bf, 0xff8fffef, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x5dffffff, 0xc05dffc0, 0xff8077ff, 0xefff807f, 0x94dfff9c, 0xbf95bdbf,
+    0xf19fb7f9, 0x87f99f83, 0x8fffe39f, 0xff8fffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x4dffffff, 0xe05d9fe0, 0x9fc0779f, 0xef9fc07f, 0xd4df9fdc, 0x8f95bd8f,
+    0xf18fb7f9, 0x87f98f83, 0x87ffe38f, 0xff87ffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045f800, 0xf90045f9, 0x01f9005d, 0x1401f91c, 0xf01401f0,
+    0x01f036c1, 0x0039f000, 0xe0f821f0, 0x21e00021, 0x0001e000, 0xfc0001e0,
+    0x01e40001, 0x0001e400, 0xe00001ec, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x0f81005f, 0x160f811e, 0xc01f0f80,
+    0x8ff03fcf, 0x1fbff83f, 0xbffffffe, 0xff8fffff, 0xffff83ff, 0xbc3fff80,
+    0xffa40fff, 0x00ffa403, 0xbff83fbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x0f81005f, 0x160f811e, 0x801f0f80,
+    0x8f803fcf, 0x0fbf801f, 0x80ffff80, 0xff800fff, 0x03ff8007, 0xbc01ff80,
+    0x7fa400ff, 0xc03fa400, 0xbffc1fbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0x81004f81, 0x0f81005f, 0x140f811c, 0x80140f80,
+    0x0f8036cf, 0x003f8000, 0x80f82f80, 0x2f80002f, 0x000f8000, 0xbc000f80,
+    0x0fa4000f, 0xf00fa780, 0xbffe0fbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x51ffffff, 0x00558000, 0x81005581, 0x1181005d, 0x1411811c, 0x80141180,
+    0x118036d1, 0x00398000, 0x80f83180, 0x31800031, 0x00118000, 0xbf001180,
+    0x11a7c011, 0xfc13a7f0, 0xbfff17bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x61ffffff, 0x00658000, 0x81006581, 0x21c1007d, 0x1421e11c, 0xf81421f0,
+    0x21fc36e1, 0x0039fe00, 0xfff821ff, 0x21ffc021, 0xf021bfe0, 0xbff8218f,
+    0x21a7fc21, 0xff21a7fe, 0xbfffa3bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x03458007, 0x81034581, 0x41c1035d, 0x1f41e11f, 0xf81f41f0,
+    0xc1fc3fc1, 0x0ff9fe0f, 0xffffe1ff, 0xe1ffffe1, 0xffc1bfff, 0xbfffc18f,
+    0xc1a7ffc1, 0xffc1a7ff, 0xbfffc1bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xf1ffffff, 0x03f58007, 0xc103f581, 0xa1e103fd, 0x1fa3f11f, 0xf81fa3f8,
+    0xe7fc3fe7, 0x0ffffe0f, 0xffffffff, 0xffffffff, 0xffffbfff, 0xbfffff8f,
+    0xf9a7fffd, 0xfff1a7ff, 0xbfffe1bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xd1ffffff, 0x03f5c003, 0xe103f5c1, 0xb1f103fd, 0x1fb3f11f, 0xfc1fa3f8,
+    0xe7fc3fe7, 0x0ffffe0f, 0xffffffff, 0xffffffff, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xfffda7ff, 0xbffff1bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x03c5e003, 0xf103c5e1, 0xb1f103fd, 0x1fb1f91f, 0xfc1fb3fc,
+    0xe7fe3fe3, 0x0ffffe0f, 0xffffffff, 0xffffffff, 0xffffbfff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbffff9bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x05c5f005, 0xf905c5f1, 0xb9f905dd, 0x1db1fd1d, 0xfe1db3fc,
+    0xe7fe3fe3, 0x0fffff0f, 0xffffefff, 0xffffffff, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbffffdbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x09c5f808, 0xf909c5f9, 0x99fd09dd, 0x1db9fd1d, 0xfe1db1fe,
+    0xe7fe3ff3, 0x0fffff0f, 0xffffefff, 0xffbfffff, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x10c5fc10, 0xfd10c5fd, 0xddfd11dd, 0x15b9ff1d, 0xfe15b1fe,
+    0xe3ff37f1, 0x17ffff17, 0xffffefff, 0xffbfffff, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x20c5fe20, 0xff20c5ff, 0xddff20dd, 0x3599ff3d, 0xff35b9ff,
+    0xe3ff37f1, 0x27ffff27, 0xbfffefff, 0xff9fffff, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x4045fe40, 0xff40c7ff, 0xdfff40df, 0x55ddff5c, 0xff55b9ff,
+    0xe1ff77f1, 0x47fbff47, 0x9fffe7bf, 0xff9fffef, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x8045ff80, 0xff8047ff, 0xcfff80df, 0x95ddff9c, 0xff95b9ff,
+    0xe1bfb7f1, 0x87fbbf87, 0x9fffe79f, 0xff8fffef, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x59ffffff, 0x805dffc0, 0xff8077ff, 0xefbf807f, 0x94dfbf9c, 0x9f95bdbf,
+    0xf19fb7f9, 0x87f99f87, 0x8fffe78f, 0xff8fffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbfffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x5dffffff, 0xc05d9fe0, 0x9fc0779f, 0xef8fc07f, 0xd4df8fdc, 0x8f95bd8f,
+    0xf18fb7f9, 0x87f98f83, 0x87ffe787, 0xff87ffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x4dffffff, 0xc05d87e0, 0x87c07787, 0x6f87c07f, 0xd4df87dc, 0x8795bd87,
+    0xf187b7f9, 0x87f98783, 0x87ffe387, 0xff87ffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x00458800, 0x89004789, 0x0f89005f, 0x141f891c, 0x88143d88,
+    0xf18836f9, 0x01f98800, 0x88fbe388, 0xff8807ef, 0x1fff880f, 0xbc3fff88,
+    0xffac7fff, 0xffffacff, 0xabffffad, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x00459000, 0x91004591, 0x0191005d, 0x1401911c, 0x90140190,
+    0x019036c1, 0x00399000, 0x90f82190, 0x3f900027, 0x007f9000, 0xbc01ff90,
+    0xffb407ff, 0x7fffb41f, 0xf1ffffbc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045e000, 0xe10045e1, 0x01e1005d, 0x1401e11c, 0xe01401e0,
+    0x01e036c1, 0x0039e000, 0xe0f821e0, 0x21e00021, 0x0001e000, 0xfc000fe0,
+    0xffe4007f, 0x1fffe403, 0xe0ffffec, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045f800, 0xf90045f9, 0x01f1005d, 0x1401f11c, 0xf01401f0,
+    0x01f036c1, 0x0039f000, 0xe0f821e0, 0x21e00021, 0x0001e000, 0xfc0001e0,
+    0x7fe40007, 0x07ffe400, 0xe07fffec, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x0f81005f, 0x160f811e, 0x801f0f80,
+    0x8f803fcf, 0x0fbf801f, 0x80ffff80, 0xff800fff, 0x03ff8007, 0xbc01ff80,
+    0x7fa700ff, 0xf83fa7c0, 0xbffe1fbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x47ffffff, 0x00478000, 0x81004781, 0x0f81005f, 0x160f811e, 0x80170f80,
+    0x8f8037cf, 0x01bf8001, 0x80f8ff80, 0x7f8000ff, 0x007f8000, 0xbf003f80,
+    0x1fa7c03f, 0xfc1fa7f0, 0xbfff0fbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x4bffffff, 0x004f8000, 0x81004f81, 0x0f81005f, 0x140f811c, 0x80140f80,
+    0x0f8036cf, 0x003f8000, 0xf0f82fe0, 0x2ffc002f, 0x800fbe00, 0xbfc00f8f,
+    0x0fa7f00f, 0xfe0fa7f8, 0xbfff0fbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x51ffffff, 0x00558000, 0x81005581, 0x11c1005d, 0x1411e11c, 0xf81411f0,
+    0x11fc36d1, 0x0039fe00, 0xfff831ff, 0x31ffc031, 0xf011bfe0, 0xbff8118f,
+    0x13a7fc13, 0xff17a7fe, 0xbfff97bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x61ffffff, 0x00658000, 0x81006581, 0x21c1007d, 0x1421e11c, 0xf81421f0,
+    0x21fc36e1, 0x0039fe00, 0xfff821ff, 0x21fffc21, 0xfe21bffc, 0xbffe218f,
+    0x21a7ff21, 0xffa3a7ff, 0xbfffa7bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x03458007, 0xc1034581, 0x41e1035d, 0x1f41f11f, 0xf81f41f0,
+    0xc1fc3fc1, 0x0ff9fe0f, 0xffffe1ff, 0xe1ffffe1, 0xffc1bfff, 0xbfffc18f,
+    0xc1a7ffc1, 0xffc1a7ff, 0xbfffc3bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xf1ffffff, 0x03f58007, 0xe103f5c1, 0xa1e103fd, 0x1fa3f11f, 0xfc1fa3f8,
+    0xe7fc3fe7, 0x0ffffe0f, 0xfffffdff, 0xf9fffffd, 0xfff9bfff, 0xbffff18f,
+    0xe1a7fff1, 0xffe1a7ff, 0xbfffc3bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xf1ffffff, 0x03f5c003, 0xe103f5e1, 0xb1f103fd, 0x1fb3f91f, 0xfc1fa3f8,
+    0xe7fe3fe7, 0x0ffffe0f, 0xffffffff, 0xffffffff, 0xffff9fff, 0xbfffff8f,
+    0xf9a7fffd, 0xfff1a7ff, 0xbfffe1bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x03c5e003, 0xf103c5f1, 0xb1f903fd, 0x1fb3f91f, 0xfc1fb3fc,
+    0xe7fe3fe7, 0x0ffffe0f, 0xffffffff, 0xffbfffff, 0xffff9fff, 0xbfffff8f,
+    0xfda7ffff, 0xfff9a7ff, 0xbfffe1bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x05c5f005, 0xf905c5f1, 0xb9f905dd, 0x1db1fd1d, 0xfe1db3fc,
+    0xe7fe3fe3, 0x0fffff0f, 0xffffefff, 0xffbfffff, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xfffda7ff, 0xbffff1bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x09c5f809, 0xfd09c5f9, 0x99fd09dd, 0x1db9fd1d, 0xfe1db3fe,
+    0xe7fe3ff3, 0x0fffff0f, 0xffffefff, 0xffbfffff, 0xffff9fff, 0xbfffff8f,
+    0xffa7ffff, 0xffffa7ff, 0xbffff1bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x10c5fc10, 0xfd10c5fd, 0xd9ff11dd, 0x15b9ff1d, 0xfe15b1fe,
+    0xe3ff37f3, 0x17ffff17, 0xbfffefff, 0xff9fffff, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbffff9bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xc1ffffff, 0x20c5fe20, 0xff20c5ff, 0xddff20dd, 0x35b9ff3d, 0xff35b9ff,
+    0xe3ff37f1, 0x27ffff27, 0x9fffefbf, 0xff9fffff, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbffff9bf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x4045fe40, 0xff40c5ff, 0xddff40dd, 0x55ddff5c, 0xff55b9ff,
+    0xe3ff77f1, 0x47ffbf47, 0x9fffef9f, 0xff8fffff, 0xffff8fff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xbffffdbf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x8045ff80, 0xff8047ff, 0xdfff80df, 0x95ddff9c, 0xbf95b9bf,
+    0xe1bfb7f1, 0x87fb9f87, 0x8fffe79f, 0xff8fffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xaffffdaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x8045ff80, 0xbf8047bf, 0xcfbf80df, 0x95dd9f9c, 0x9f95b99f,
+    0xe19fb7f1, 0x87fb8f87, 0x8fffe78f, 0xff87ffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xafffffaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x5dffffff, 0xc05d9fc0, 0x8fc0778f, 0xef8fc07f, 0x94df8fdc, 0x8f95bd8f,
+    0xf18fb7f9, 0x87fb8783, 0x87ffe787, 0xff87ffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x5dffffff, 0xc05d87e0, 0x87c07787, 0xef87c07f, 0xd4df87dc, 0x8795bd87,
+    0xf187b7f9, 0x87f98783, 0x87ffe787, 0xff87ffef, 0xffff87ff, 0xbfffff87,
+    0xffa7ffff, 0xffffa7ff, 0xa7ffffaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x4dffffff, 0x005d8800, 0x89007789, 0x6f89007f, 0x14df891c, 0x8815bd88,
+    0xf18837f9, 0x07f98803, 0x88ffe388, 0xff887fef, 0xffff887f, 0xbcffff88,
+    0xffadffff, 0xffffadff, 0xebffffaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x00459000, 0x91004791, 0x0f91005f, 0x141f911c, 0x90143d90,
+    0xf19036f9, 0x01f99000, 0x90fbe390, 0xff9007ef, 0x1fff900f, 0xbc3fff90,
+    0xffb47fff, 0xffffb4ff, 0xf3fffffd, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045e000, 0xe10045e1, 0x01e1005d, 0x1401e11c, 0xe01401e0,
+    0x01e036c1, 0x0039e000, 0xe0f823e0, 0xffe0006f, 0x03ffe000, 0xfc07ffe0,
+    0xffe41fff, 0xffffe43f, 0xe1ffffec, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x41ffffff, 0x0045f800, 0xf10045f1, 0x01f1005d, 0x1401f11c, 0xf01401f0,
+    0x01f036c1, 0x0039e000, 0xe0f821e0, 0x3fe00027, 0x007fe000, 0xfc01ffe0,
+    0xffe407ff, 0x7fffe41f, 0xe1ffffec, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+};
@@ -3,16 +3,12 @@
 #include <iostream>
 #include <random>
 
-Menu::Menu(SDL_Renderer* renderer) : renderer(renderer) {
+Menu::Menu(SDL_Renderer* renderer, const TextRenderer& text)
+    : renderer(renderer), text(text), backgroundTexture(nullptr) {
     std::random_device rd; // obtain a random number from hardware
     std::mt19937 gen(rd()); // seed the generator
     std::uniform_int_distribution<> distr(1, 4); // define the range
 
-    font = TTF_OpenFont("arial.ttf", 24);
-    if (!font) {
-        std::cerr << "Failed to load font: " << TTF_GetError() << std::endl;
-    }
-
     std::string filePath = "wall" + std::to_string(distr(gen)) + ".png";
     SDL_Surface* bgSurface = IMG_Load(filePath.c_str()); // Change file name if needed
     if (!bgSurface) {
@@ -26,13 +22,17 @@ Menu::Menu(SDL_Renderer* renderer) : renderer(renderer) {
     playButtonRect.h = 50;   // Height
     playButtonRect.x = (SCREEN_WIDTH - playButtonRect.w) / 2;  // Center X
     playButtonRect.y = (SCREEN_HEIGHT - playButtonRect.h) / 2;  // Center Y
+
+    // ✅ Center "PLAY" inside the button
+    text.setText(playLabel, "PLAY", {0, 0, 0, 255}); // Black text
+    text.setPosition(playLabel, playButtonRect.x + (playButtonRect.w - playLabel.width) / 2,
+                     playButtonRect.y + (playButtonRect.h - playLabel.height) / 2);
 }
 
 Menu::~Menu() {
     if (backgroundTexture) {
         SDL_DestroyTexture(backgroundTexture); // ✅ Free the background texture
     }
-    TTF_CloseFont(font);
 }
 
 void Menu::render() {
@@ -75,24 +75,7 @@ void Menu::render() {
     SDL_RenderDrawRect(renderer, &playButtonRect);
 
     // ✅ Render "PLAY" text
-    SDL_Color textColor = {0, 0, 0, 255}; // Black text
-    SDL_Surface* surfaceMessage = TTF_RenderText_Solid(font, "PLAY", textColor);
-    SDL_Texture* message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
-
-    // ✅ Center text inside button
-    SDL_Rect messageRect;
-    messageRect.w = surfaceMessage->w;
-    messageRect.h = surfaceMessage->h;
-    messageRect.x = playButtonRect.x + (playButtonRect.w - messageRect.w) / 2;
-    messageRect.y = playButtonRect.y + (playButtonRect.h - messageRect.h) / 2;
-
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
-    
-    SDL_RenderPresent(renderer);
+    text.draw(playLabel);
 }
 
 SDL_Keycode Menu::handleInput() {
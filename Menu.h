@@ -6,11 +6,12 @@
 #include <iostream>
 #include <SDL2/SDL_image.h>
 #include "common.h"
+#include "TextRenderer.h"
 
 
 class Menu {
 public:
-    Menu(SDL_Renderer* renderer);
+    Menu(SDL_Renderer* renderer, const TextRenderer& text);
     ~Menu();
 
     void render();
@@ -18,7 +19,8 @@ public:
 
 private:
     SDL_Renderer* renderer;
-    TTF_Font* font;
+    const TextRenderer& text;
+    TextLabel playLabel; // Laid out once, the button never moves
     SDL_Texture* backgroundTexture;
     SDL_Rect playButtonRect;
 
@@ -0,0 +1,144 @@
+#include "Movement.h"
+#include <algorithm>
+#include <cmath>
+
+bool checkCollision(double x, double y, size_t currentPlayerIndex,
+                    const std::vector<PlayerState>& players) {
+    // Check map boundaries
+    if (x < 0 || x >= MAP_WIDTH || y < 0 || y >= MAP_HEIGHT) {
+        return true;
+    }
+
+    // Check the 4 cells around the player's position (including buffer)
+    int minX = static_cast<int>(x - PLAYER_RADIUS - WALL_BUFFER);
+    int maxX = static_cast<int>(x + PLAYER_RADIUS + WALL_BUFFER);
+    int minY = static_cast<int>(y - PLAYER_RADIUS - WALL_BUFFER);
+    int maxY = static_cast<int>(y + PLAYER_RADIUS + WALL_BUFFER);
+
+    // Clamp to map boundaries
+    minX = std::max(0, minX);
+    maxX = std::min(MAP_WIDTH - 1, maxX);
+    minY = std::max(0, minY);
+    maxY = std::min(MAP_HEIGHT - 1, maxY);
+
+    // Check each cell in the area
+    for (int checkX = minX; checkX <= maxX; checkX++) {
+        for (int checkY = minY; checkY <= maxY; checkY++) {
+            if (worldMap[checkX][checkY] > 0) { // If there's a wall
+                // Calculate detailed collision with wall boundaries
+                double wallMinX = checkX;
+                double wallMaxX = checkX + 1.0;
+                double wallMinY = checkY;
+                double wallMaxY = checkY + 1.0;
+
+                // Check if player's collision circle intersects with wall square
+                double closestX = std::max(wallMinX, std::min(wallMaxX, x));
+                double closestY = std::max(wallMinY, std::min(wallMaxY, y));
+
+                double distanceX = x - closestX;
+                double distanceY = y - closestY;
+                double distanceSquared = (distanceX * distanceX) + (distanceY * distanceY);
+
+                if (distanceSquared < (PLAYER_RADIUS + WALL_BUFFER) * (PLAYER_RADIUS + WALL_BUFFER)) {
+                    return true; // Collision detected
+                }
+            }
+        }
+    }
+
+    // Check collision with other players
+    for (size_t i = 0; i < players.size(); i++) {
+        // Skip checking collision with self
+        if (i == currentPlayerIndex)
+            continue;
+
+        const PlayerState& otherPlayer = players[i];
+
+        // Quick AABB check first for performance
+        if (std::abs(otherPlayer.posX - x) < PLAYER_RADIUS * 2 &&
+            std::abs(otherPlayer.posY - y) < PLAYER_RADIUS * 2) {
+
+            // More precise circle collision check
+            double dx = otherPlayer.posX - x;
+            double dy = otherPlayer.posY - y;
+            double distanceSquared = dx * dx + dy * dy;
+
+            if (distanceSquared < (PLAYER_RADIUS * 2) * (PLAYER_RADIUS * 2)) {
+                return true; // Player collision detected
+            }
+        }
+    }
+
+    return false; // No collision
+}
+
+// Rotate the view direction and camera plane together
+static void rotatePlayer(PlayerState& player, double angle) {
+    double oldDirX = player.dirX;
+    player.dirX = player.dirX * cos(angle) - player.dirY * sin(angle);
+    player.dirY = oldDirX * sin(angle) + player.dirY * cos(angle);
+    double oldPlaneX = player.planeX;
+    player.planeX = player.planeX * cos(angle) - player.planeY * sin(angle);
+    player.planeY = oldPlaneX * sin(angle) + player.planeY * cos(angle);
+}
+
+void applyInput(std::vector<PlayerState>& players, size_t playerIndex, const InputPacket& input,
+                double dt) {
+    PlayerState& player = players[playerIndex];
+    double prevX = player.posX;
+    double prevY = player.posY;
+
+    dt = std::max(0.0, std::min(MAX_INPUT_DT, dt));
+    const double moveSpeed = BASE_MOVE_SPEED * dt;
+    const double rotSpeed = BASE_ROT_SPEED * dt;
+
+    // Store original position for collision resolution
+    double newX = player.posX;
+    double newY = player.posY;
+
+    if (input.mouseRotation != 0.0) {
+        rotatePlayer(player, -input.mouseRotation); // Negative because screen coordinates
+    }
+    if (input.turnRight) {
+        rotatePlayer(player, -rotSpeed);
+    }
+    if (input.turnLeft) {
+        rotatePlayer(player, rotSpeed);
+    }
+
+    // Handle movement with collision detection
+    if (input.forward) {
+        newX = player.posX + player.dirX * moveSpeed;
+        newY = player.posY + player.dirY * moveSpeed;
+    }
+    if (input.backward) {
+        newX = player.posX - player.dirX * moveSpeed;
+        newY = player.posY - player.dirY * moveSpeed;
+    }
+    if (input.strafeRight) {
+        newX = player.posX + player.dirY * moveSpeed;
+        newY = player.posY - player.dirX * moveSpeed;
+    }
+    if (input.strafeLeft) {
+        newX = player.posX - player.dirY * moveSpeed;
+        newY = player.posY + player.dirX * moveSpeed;
+    }
+
+    // Try to move with collision detection
+    // First try the full movement
+    if (!checkCollision(newX, newY, playerIndex, players)) {
+        player.posX = newX;
+        player.posY = newY;
+    } else {
+        // If collision, try moving along X axis only
+        if (!checkCollision(newX, player.posY, playerIndex, players)) {
+            player.posX = newX;
+        }
+        // Try moving along Y axis only
+        else if (!checkCollision(player.posX, newY, playerIndex, players)) {
+            player.posY = newY;
+        }
+        // If both failed, player stays in current position
+    }
+    player.isMoving = (player.posX != prevX || player.posY != prevY);
+}
@@ -0,0 +1,24 @@
+#ifndef MOVEMENT_H
+#define MOVEMENT_H
+
+#include "common.h"
+#include <vector>
+
+// Player movement and collision, shared so the client can predict its own
+// movement with exactly the code the server runs
+const double PLAYER_RADIUS = 0.2; // Collision radius for players
+const double WALL_BUFFER = 0.1;   // Extra buffer space from walls
+const double BASE_MOVE_SPEED = 6.0; // Cells per second
+const double BASE_ROT_SPEED = 3.0;  // Radians per second
+const double MAX_INPUT_DT = 0.1; // Longest step one input may cover, in seconds
+
+// Function prototypes
+// True if a player at (x, y) would overlap a wall, the map edge or another
+// player (other than currentPlayerIndex)
+bool checkCollision(double x, double y, size_t currentPlayerIndex,
+                    const std::vector<PlayerState>& players);
+// Advance players[playerIndex] by one input covering dt seconds
+void applyInput(std::vector<PlayerState>& players, size_t playerIndex, const InputPacket& input,
+                double dt);
+
+#endif
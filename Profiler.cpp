@@ -0,0 +1,180 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+// Events kept per thread, a power of two
+static const uint64_t RING_CAPACITY = 1 << 16;
+
+// Slots are written by their thread while another thread may be reading
+// them, so every field is atomic; relaxed stores are ordered by `head`
+struct ProfileSlot {
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> startNs;
+    std::atomic<uint64_t> endNs;
+};
+
+struct ThreadRing {
+    std::string name;
+    std::unique_ptr<ProfileSlot[]> slots;
+    std::atomic<uint64_t> head; // Total events ever written
+
+    ThreadRing() : slots(new ProfileSlot[RING_CAPACITY]), head(0) {}
+};
+
+// Rings live until exit so a trace can still show threads that finished
+static std::mutex registryMutex;
+static std::vector<std::unique_ptr<ThreadRing>> rings;
+static thread_local int threadIndex = -1;
+
+static const std::chrono::steady_clock::time_point clockStart = std::chrono::steady_clock::now();
+
+uint64_t profilerNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                clockStart)
+        .count();
+}
+
+int profilerThreadIndex() {
+    if (threadIndex < 0) {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        threadIndex = (int)rings.size();
+        rings.emplace_back(new ThreadRing());
+        rings.back()->name = "thread " + std::to_string(threadIndex);
+    }
+    return threadIndex;
+}
+
+static ThreadRing& threadRing() {
+    int index = profilerThreadIndex();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return *rings[index];
+}
+
+void profilerSetThreadName(const std::string& name) {
+    int index = profilerThreadIndex();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    rings[index]->name = name;
+}
+
+std::vector<std::string> profilerThreadNames() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::vector<std::string> names;
+    for (const auto& ring : rings) {
+        names.push_back(ring->name);
+    }
+    return names;
+}
+
+ProfileScope::ProfileScope(const char* name) : name(name), startNs(profilerNow()) {
+}
+
+ProfileScope::~ProfileScope() {
+    uint64_t endNs = profilerNow();
+
+    // The ring pointer is cached per thread after the first event
+    static thread_local ThreadRing* ring = nullptr;
+    if (!ring) {
+        ring = &threadRing();
+    }
+
+    uint64_t index = ring->head.load(std::memory_order_relaxed);
+    ProfileSlot& slot = ring->slots[index & (RING_CAPACITY - 1)];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.endNs.store(endNs, std::memory_order_relaxed);
+    ring->head.store(index + 1, std::memory_order_release);
+}
+
+std::vector<ProfileEvent> profilerCollect(uint64_t sinceNs, int thread) {
+    std::vector<ThreadRing*> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const auto& ring : rings) {
+            snapshot.push_back(ring.get());
+        }
+    }
+
+    std::vector<ProfileEvent> events;
+    for (int t = 0; t < (int)snapshot.size(); t++) {
+        if (thread >= 0 && t != thread) {
+            continue;
+        }
+        ThreadRing& ring = *snapshot[t];
+
+        // Events are written when they end, so each ring is sorted by end
+        // time and only the tail newer than sinceNs needs copying
+        uint64_t head = ring.head.load(std::memory_order_acquire);
+        uint64_t first = head > RING_CAPACITY ? head - RING_CAPACITY : 0;
+        uint64_t start = head;
+        while (start > first &&
+               ring.slots[(start - 1) & (RING_CAPACITY - 1)].endNs.load(std::memory_order_relaxed) >=
+                   sinceNs) {
+            start--;
+        }
+
+        size_t begin = events.size();
+        for (uint64_t i = start; i < head; i++) {
+            const ProfileSlot& slot = ring.slots[i & (RING_CAPACITY - 1)];
+            ProfileEvent event;
+            event.name = slot.name.load(std::memory_order_relaxed);
+            event.startNs = slot.startNs.load(std::memory_order_relaxed);
+            event.endNs = slot.endNs.load(std::memory_order_relaxed);
+            event.thread = t;
+            events.push_back(event);
+        }
+
+        // Drop anything the writer may have lapped while we were copying
+        uint64_t newHead = ring.head.load(std::memory_order_acquire);
+        uint64_t oldestValid = newHead >= RING_CAPACITY ? newHead - RING_CAPACITY + 1 : 0;
+        if (oldestValid > start) {
+            size_t lapped = (size_t)std::min(oldestValid - start, head - start);
+            events.erase(events.begin() + begin, events.begin() + begin + lapped);
+        }
+    }
+    return events;
+}
+
+static std::string jsonString(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+
+bool profilerWriteTrace(const std::string& file) {
+    std::vector<ProfileEvent> events = profilerCollect(0);
+    std::vector<std::string> names = profilerThreadNames();
+
+    std::ofstream out(file);
+    if (!out) {
+        return false;
+    }
+
+    // Complete ("X") events in microseconds, plus one metadata event per
+    // thread so the viewer shows thread names
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (int t = 0; t < (int)names.size(); t++) {
+        out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << t << ",\"args\":{\"name\":" << jsonString(names[t]) << "}}";
+        first = false;
+    }
+    for (const ProfileEvent& event : events) {
+        out << (first ? "" : ",\n") << "{\"name\":" << jsonString(event.name)
+            << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+            << ",\"ts\":" << event.startNs / 1000.0
+            << ",\"dur\":" << (event.endNs - event.startNs) / 1000.0 << "}";
+        first = false;
+    }
+    out << "\n]}\n";
+    return (bool)out;
+}
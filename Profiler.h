@@ -0,0 +1,47 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Hot-path instrumentation. PROFILE_SCOPE records the time spent in the
+// enclosing block into a ring buffer owned by the calling thread, so marking
+// a scope costs two clock reads and no locks. Old events are overwritten once
+// a thread's buffer wraps.
+struct ProfileEvent {
+    const char* name; // Must be a string literal or otherwise outlive the profiler
+    uint64_t startNs;
+    uint64_t endNs;
+    int thread; // Index into profilerThreadNames()
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name;
+    uint64_t startNs;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+
+// Function prototypes
+uint64_t profilerNow(); // Nanoseconds on the clock events are stamped with
+int profilerThreadIndex(); // Registers the calling thread on first use
+void profilerSetThreadName(const std::string& name);
+std::vector<std::string> profilerThreadNames();
+// Events that ended at or after sinceNs, from every thread or just one
+std::vector<ProfileEvent> profilerCollect(uint64_t sinceNs, int thread = -1);
+// Write everything still in the ring buffers as a Chrome trace
+// (chrome://tracing or ui.perfetto.dev). Returns false if the file can't be written.
+bool profilerWriteTrace(const std::string& file);
+
+#endif
@@ -0,0 +1,80 @@
+#include "ProfilerOverlay.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+ProfilerOverlay::ProfilerOverlay(const TextRenderer& text)
+    : text(text), visible(false), windowStartNs(0), frames(0) {
+    text.setPosition(label, 18, 18);
+}
+
+void ProfilerOverlay::toggle() {
+    visible = !visible;
+    // Start a fresh window so the first numbers shown are current
+    windowStartNs = profilerNow();
+    frames = 0;
+    text.setText(label, "Profiling...", {255, 255, 255, 255});
+}
+
+void ProfilerOverlay::update() {
+    if (!visible) {
+        return;
+    }
+
+    frames++;
+    uint64_t now = profilerNow();
+    if (now - windowStartNs < WINDOW_NS) {
+        return;
+    }
+
+    // Total and worst time per scope name, in the order they first appear
+    struct ScopeTotal {
+        const char* name;
+        uint64_t totalNs;
+        uint64_t maxNs;
+    };
+    std::vector<ScopeTotal> totals;
+    for (const ProfileEvent& event : profilerCollect(windowStartNs, profilerThreadIndex())) {
+        if (event.startNs < windowStartNs) {
+            continue;
+        }
+        uint64_t duration = event.endNs - event.startNs;
+        auto it = std::find_if(totals.begin(), totals.end(), [&](const ScopeTotal& total) {
+            return strcmp(total.name, event.name) == 0;
+        });
+        if (it == totals.end()) {
+            totals.push_back({event.name, duration, duration});
+        } else {
+            it->totalNs += duration;
+            it->maxNs = std::max(it->maxNs, duration);
+        }
+    }
+
+    char line[128];
+    snprintf(line, sizeof(line), "%.1f fps   avg ms/frame   max ms\n",
+             frames * 1e9 / (now - windowStartNs));
+    std::string table = line;
+    for (const ScopeTotal& total : totals) {
+        snprintf(line, sizeof(line), "%-14s %8.2f %8.2f\n", total.name,
+                 total.totalNs / 1e6 / frames, total.maxNs / 1e6);
+        table += line;
+    }
+    table += "F3 hide, F4 save trace";
+    text.setText(label, table, {255, 255, 255, 255});
+
+    windowStartNs = now;
+    frames = 0;
+}
+
+void ProfilerOverlay::render(SDL_Renderer* renderer) const {
+    if (!visible) {
+        return;
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 160);
+    SDL_Rect background = {label.x - 8, label.y - 8, label.width + 16, label.height + 16};
+    SDL_RenderFillRect(renderer, &background);
+    text.draw(label);
+}
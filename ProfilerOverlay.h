@@ -0,0 +1,31 @@
+#ifndef PROFILEROVERLAY_H
+#define PROFILEROVERLAY_H
+
+#include "Profiler.h"
+#include "TextRenderer.h"
+#include <SDL2/SDL.h>
+
+// On-screen table of the calling thread's profiler scopes, averaged per
+// frame over a short window. Hidden by default.
+class ProfilerOverlay {
+public:
+    explicit ProfilerOverlay(const TextRenderer& text);
+
+    void toggle();
+    bool isVisible() const { return visible; }
+
+    // Call once per frame from the thread whose scopes are shown
+    void update();
+    void render(SDL_Renderer* renderer) const;
+
+private:
+    static const uint64_t WINDOW_NS = 500000000; // Refresh twice a second
+
+    const TextRenderer& text;
+    TextLabel label;
+    bool visible;
+    uint64_t windowStartNs;
+    int frames; // Frames since windowStartNs
+};
+
+#endif
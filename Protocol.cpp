@@ -0,0 +1,204 @@
+#include "Protocol.h"
+#include <algorithm>
+#include <cmath>
+
+static const uint8_t ADMIN_FLAG = 1 << 0;
+static const uint8_t MOVING_FLAG = 1 << 1;
+
+static void writePlayerState(WireWriter& out, const PlayerState& state) {
+    out.writeU8((state.isAdmin ? ADMIN_FLAG : 0) | (state.isMoving ? MOVING_FLAG : 0));
+    out.writeF64(state.posX);
+    out.writeF64(state.posY);
+    out.writeF64(state.dirX);
+    out.writeF64(state.dirY);
+    out.writeF64(state.planeX);
+    out.writeF64(state.planeY);
+}
+
+// Returns false if any of the numbers is NaN or infinite
+static bool readPlayerState(WireReader& in, PlayerState& state) {
+    uint8_t flags = in.readU8();
+    state.isAdmin = (flags & ADMIN_FLAG) != 0;
+    state.isMoving = (flags & MOVING_FLAG) != 0;
+    state.posX = in.readF64();
+    state.posY = in.readF64();
+    state.dirX = in.readF64();
+    state.dirY = in.readF64();
+    state.planeX = in.readF64();
+    state.planeY = in.readF64();
+    return std::isfinite(state.posX) && std::isfinite(state.posY) && std::isfinite(state.dirX) &&
+           std::isfinite(state.dirY) && std::isfinite(state.planeX) && std::isfinite(state.planeY);
+}
+
+void writeWelcome(WireWriter& out, const WelcomePacket& message) {
+    out.beginMessage(WELCOME);
+    out.writeU8(message.playerID);
+    out.writeU16(message.tickRate);
+    out.endMessage();
+}
+
+bool readWelcome(WireReader& in, WelcomePacket& message) {
+    message.playerID = in.readU8();
+    message.tickRate = in.readU16();
+    return in.ok() && message.tickRate > 0;
+}
+
+void writePosition(WireWriter& out, const PositionPacket& message) {
+    out.beginMessage(PLAYER_POSITION);
+    out.writeU8(message.playerID);
+    writePlayerState(out, message.state);
+    out.writeU32(message.lastInput);
+    out.endMessage();
+}
+
+bool readPosition(WireReader& in, PositionPacket& message) {
+    message.playerID = in.readU8();
+    bool finite = readPlayerState(in, message.state);
+    message.lastInput = in.readU32();
+    return in.ok() && finite;
+}
+
+// Movement keys, one bit each
+enum InputFlag {
+    INPUT_FORWARD = 1 << 0,
+    INPUT_BACKWARD = 1 << 1,
+    INPUT_STRAFE_LEFT = 1 << 2,
+    INPUT_STRAFE_RIGHT = 1 << 3,
+    INPUT_TURN_LEFT = 1 << 4,
+    INPUT_TURN_RIGHT = 1 << 5
+};
+
+void writeInputBatch(WireWriter& out, const InputBatchPacket& message) {
+    uint8_t count = uint8_t(std::min<size_t>(message.count, INPUT_REDUNDANCY));
+    out.beginMessage(PLAYER_INPUT);
+    out.writeU32(message.ackTick);
+    out.writeU8(count);
+    for (size_t i = 0; i < count; i++) {
+        const InputPacket& input = message.inputs[i];
+        out.writeU8((input.forward ? INPUT_FORWARD : 0) | (input.backward ? INPUT_BACKWARD : 0) |
+                    (input.strafeLeft ? INPUT_STRAFE_LEFT : 0) |
+                    (input.strafeRight ? INPUT_STRAFE_RIGHT : 0) |
+                    (input.turnLeft ? INPUT_TURN_LEFT : 0) |
+                    (input.turnRight ? INPUT_TURN_RIGHT : 0));
+        // Full precision, so the server turns exactly as the client predicted
+        out.writeF64(input.mouseRotation);
+        out.writeU32(input.sequence);
+        out.writeU32(input.clientTick);
+    }
+    out.endMessage();
+}
+
+bool readInputBatch(WireReader& in, InputBatchPacket& message) {
+    message.ackTick = in.readU32();
+    message.count = in.readU8();
+    if (message.count > INPUT_REDUNDANCY) {
+        return false;
+    }
+    for (size_t i = 0; i < message.count; i++) {
+        InputPacket& input = message.inputs[i];
+        uint8_t flags = in.readU8();
+        input.forward = (flags & INPUT_FORWARD) != 0;
+        input.backward = (flags & INPUT_BACKWARD) != 0;
+        input.strafeLeft = (flags & INPUT_STRAFE_LEFT) != 0;
+        input.strafeRight = (flags & INPUT_STRAFE_RIGHT) != 0;
+        input.turnLeft = (flags & INPUT_TURN_LEFT) != 0;
+        input.turnRight = (flags & INPUT_TURN_RIGHT) != 0;
+        input.mouseRotation = in.readF64();
+        input.sequence = in.readU32();
+        input.clientTick = in.readU32();
+        if (!std::isfinite(input.mouseRotation) ||
+            std::abs(input.mouseRotation) > MAX_MOUSE_ROTATION) {
+            return false;
+        }
+    }
+    return in.ok();
+}
+
+void writeShotAttempt(WireWriter& out, const ShotAttemptPacket& message) {
+    out.beginMessage(SHOT_ATTEMPT);
+    out.writeU8(uint8_t(message.shooterID));
+    out.writeF64(message.shooterPosX);
+    out.writeF64(message.shooterPosY);
+    out.writeF64(message.shooterDirX);
+    out.writeF64(message.shooterDirY);
+    out.endMessage();
+}
+
+bool readShotAttempt(WireReader& in, ShotAttemptPacket& message) {
+    message.shooterID = in.readU8();
+    message.shooterPosX = in.readF64();
+    message.shooterPosY = in.readF64();
+    message.shooterDirX = in.readF64();
+    message.shooterDirY = in.readF64();
+    return in.ok() && std::isfinite(message.shooterPosX) && std::isfinite(message.shooterPosY) &&
+           std::isfinite(message.shooterDirX) && std::isfinite(message.shooterDirY);
+}
+
+void writeHitNotification(WireWriter& out, const HitNotificationPacket& message) {
+    out.beginMessage(HIT_NOTIFICATION);
+    out.writeU8(uint8_t(message.shooterID));
+    out.writeU8(uint8_t(message.targetID));
+    out.endMessage();
+}
+
+bool readHitNotification(WireReader& in, HitNotificationPacket& message) {
+    message.shooterID = in.readU8();
+    message.targetID = in.readU8();
+    return in.ok();
+}
+
+void writeLobbyUpdate(WireWriter& out, const LobbyUpdatePacket& message) {
+    uint8_t count = uint8_t(std::min<size_t>(message.numPlayers, MAX_LOBBY_PLAYERS));
+    out.beginMessage(LOBBY_UPDATE);
+    out.writeU8(count);
+    for (size_t i = 0; i < count; i++) {
+        writePlayerState(out, message.players[i]);
+    }
+    out.endMessage();
+}
+
+bool readLobbyUpdate(WireReader& in, LobbyUpdatePacket& message) {
+    message.numPlayers = in.readU8();
+    if (message.numPlayers > MAX_LOBBY_PLAYERS) {
+        return false;
+    }
+    for (size_t i = 0; i < message.numPlayers; i++) {
+        if (!readPlayerState(in, message.players[i])) {
+            return false;
+        }
+    }
+    return in.ok();
+}
+
+void writeGameStart(WireWriter& out, const GameStartPacket& message) {
+    out.beginMessage(GAME_START);
+    out.writeU8(message.startGame ? 1 : 0);
+    out.endMessage();
+}
+
+bool readGameStart(WireReader& in, GameStartPacket& message) {
+    message.startGame = in.readU8() != 0;
+    return in.ok();
+}
+
+void writeJoinRequest(WireWriter& out) {
+    out.beginMessage(JOIN_REQUEST);
+    out.endMessage();
+}
+
+void writeSnapshot(WireWriter& out, const NetSnapshot& snapshot, const NetSnapshot* baseline) {
+    out.beginMessage(SNAPSHOT);
+    BitWriter bits(out.buffer());
+    encodeSnapshot(snapshot, baseline, bits);
+    out.endMessage();
+}
+
+bool readSnapshot(WireReader& in, const SnapshotRing& history, NetSnapshot& snapshot) {
+    size_t size = in.remaining();
+    const uint8_t* bytes = in.readBytes(size);
+    if (!bytes) {
+        return false;
+    }
+    BitReader bits(bytes, size);
+    return decodeSnapshot(bits, history, snapshot);
+}
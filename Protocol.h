@@ -0,0 +1,43 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include "SnapshotCodec.h"
+#include "WireFormat.h"
+#include "common.h"
+
+// Game messages on top of the wire format. Each write function appends one
+// whole message (header included) to the packet being built. Each read
+// function decodes the payload of a message of its type and returns false
+// if the payload is short or out of range, which includes any number that
+// is NaN or infinite.
+
+// Function prototypes
+void writeWelcome(WireWriter& out, const WelcomePacket& message);
+bool readWelcome(WireReader& in, WelcomePacket& message);
+
+void writePosition(WireWriter& out, const PositionPacket& message);
+bool readPosition(WireReader& in, PositionPacket& message);
+
+void writeInputBatch(WireWriter& out, const InputBatchPacket& message);
+bool readInputBatch(WireReader& in, InputBatchPacket& message);
+
+void writeShotAttempt(WireWriter& out, const ShotAttemptPacket& message);
+bool readShotAttempt(WireReader& in, ShotAttemptPacket& message);
+
+void writeHitNotification(WireWriter& out, const HitNotificationPacket& message);
+bool readHitNotification(WireReader& in, HitNotificationPacket& message);
+
+void writeLobbyUpdate(WireWriter& out, const LobbyUpdatePacket& message);
+bool readLobbyUpdate(WireReader& in, LobbyUpdatePacket& message);
+
+void writeGameStart(WireWriter& out, const GameStartPacket& message);
+bool readGameStart(WireReader& in, GameStartPacket& message);
+
+void writeJoinRequest(WireWriter& out);
+
+// The snapshot payload is the bit-packed encoding from SnapshotCodec.h,
+// decoded straight from the packet
+void writeSnapshot(WireWriter& out, const NetSnapshot& snapshot, const NetSnapshot* baseline);
+bool readSnapshot(WireReader& in, const SnapshotRing& history, NetSnapshot& snapshot);
+
+#endif
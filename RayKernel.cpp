@@ -0,0 +1,465 @@
+#include "RayKernel.h"
+#include "Map.h"
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define RAYKERNEL_HAVE_SSE2 1
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define RAYKERNEL_HAVE_AVX2 1
+#endif
+
+// A DDA ray visits at most this many cells before leaving the grid
+static const int MAX_DDA_STEPS = MAP_WIDTH + MAP_HEIGHT;
+
+void RayHits::resize(int columns) {
+    perpWallDist.resize(columns);
+    side.resize(columns);
+    mapX.resize(columns);
+    mapY.resize(columns);
+    texX.resize(columns);
+}
+
+static bool isSolid(int mapX, int mapY) {
+    if (mapX < 0 || mapX >= MAP_WIDTH || mapY < 0 || mapY >= MAP_HEIGHT)
+        return true; // Leaving the map counts as a hit
+    return worldMap[mapX][mapY] > 0;
+}
+
+// Distance and texture column for a ray that hit cell (mapX, mapY) on the
+// given side, in doubles. Every kernel finishes its rays here, so they only
+// ever differ in which cell the DDA stopped at.
+static void finishRay(const RayCamera& camera, int screenWidth, int x, int texWidth, int mapX,
+                      int mapY, int side, RayHits& hits) {
+    double cameraX = 2 * x / double(screenWidth) - 1;
+    double rayDirX = camera.dirX + camera.planeX * cameraX;
+    double rayDirY = camera.dirY + camera.planeY * cameraX;
+    int stepX = rayDirX < 0 ? -1 : 1;
+    int stepY = rayDirY < 0 ? -1 : 1;
+
+    double perpWallDist;
+    if (side == 0)
+        perpWallDist = (mapX - camera.posX + (1.0 - stepX) / 2.0) / rayDirX;
+    else
+        perpWallDist = (mapY - camera.posY + (1.0 - stepY) / 2.0) / rayDirY;
+
+    double wallX;
+    if (side == 0)
+        wallX = camera.posY + perpWallDist * rayDirY;
+    else
+        wallX = camera.posX + perpWallDist * rayDirX;
+    wallX -= floor(wallX);
+
+    int texX = int(wallX * texWidth);
+    if (side == 0 && rayDirX > 0)
+        texX = texWidth - texX - 1;
+    if (side == 1 && rayDirY < 0)
+        texX = texWidth - texX - 1;
+
+    hits.perpWallDist[x] = perpWallDist;
+    hits.side[x] = side;
+    hits.mapX[x] = mapX;
+    hits.mapY[x] = mapY;
+    hits.texX[x] = texX;
+}
+
+// Reference path: one ray at a time in doubles
+static void castRayScalar(const RayCamera& camera, int screenWidth, int x, int texWidth,
+                          RayHits& hits) {
+    double cameraX = 2 * x / double(screenWidth) - 1;
+    double rayDirX = camera.dirX + camera.planeX * cameraX;
+    double rayDirY = camera.dirY + camera.planeY * cameraX;
+
+    int mapX = int(camera.posX);
+    int mapY = int(camera.posY);
+
+    double deltaDistX = std::abs(1 / rayDirX);
+    double deltaDistY = std::abs(1 / rayDirY);
+
+    double sideDistX, sideDistY;
+    int stepX, stepY;
+    int side = 0;
+
+    if (rayDirX < 0) {
+        stepX = -1;
+        sideDistX = (camera.posX - mapX) * deltaDistX;
+    } else {
+        stepX = 1;
+        sideDistX = (mapX + 1.0 - camera.posX) * deltaDistX;
+    }
+    if (rayDirY < 0) {
+        stepY = -1;
+        sideDistY = (camera.posY - mapY) * deltaDistY;
+    } else {
+        stepY = 1;
+        sideDistY = (mapY + 1.0 - camera.posY) * deltaDistY;
+    }
+
+    for (int i = 0; i < MAX_DDA_STEPS; i++) {
+        if (sideDistX < sideDistY) {
+            sideDistX += deltaDistX;
+            mapX += stepX;
+            side = 0;
+        } else {
+            sideDistY += deltaDistY;
+            mapY += stepY;
+            side = 1;
+        }
+        if (isSolid(mapX, mapY))
+            break;
+    }
+
+    finishRay(camera, screenWidth, x, texWidth, mapX, mapY, side, hits);
+}
+
+static void castRaysScalar(const RayCamera& camera, int screenWidth, int firstColumn, int count,
+                           int texWidth, RayHits& hits) {
+    for (int x = firstColumn; x < firstColumn + count; x++) {
+        castRayScalar(camera, screenWidth, x, texWidth, hits);
+    }
+}
+
+#ifdef RAYKERNEL_HAVE_SSE2
+// Solid cells with a border of solid cells around the map, so the 4-wide DDA
+// can look cells up without bounds checks; every ray stops on the border
+static const int PADDED_HEIGHT = MAP_HEIGHT + 2;
+
+static const unsigned char* paddedSolidCells() {
+    static unsigned char cells[(MAP_WIDTH + 2) * PADDED_HEIGHT];
+    static bool built = false;
+    if (!built) {
+        for (int x = -1; x <= MAP_WIDTH; x++) {
+            for (int y = -1; y <= MAP_HEIGHT; y++) {
+                cells[(x + 1) * PADDED_HEIGHT + y + 1] = isSolid(x, y) ? 1 : 0;
+            }
+        }
+        built = true;
+    }
+    return cells;
+}
+
+// finishRay for the two columns x and x + 1 of lanes (mapX, mapY, side), one
+// double operation for each of the scalar ones so the results match it bit
+// for bit. Hit points are never negative, so truncation is the floor here.
+static inline void finishRaysSSE2(const RayCamera& camera, int screenWidth, int x, int texWidth,
+                                  __m128i mapX, __m128i mapY, __m128i sideY, double* perpWallDist,
+                                  __m128i& texX) {
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d posX = _mm_set1_pd(camera.posX);
+    const __m128d posY = _mm_set1_pd(camera.posY);
+
+    __m128d cameraX = _mm_sub_pd(_mm_div_pd(_mm_set_pd(2.0 * (x + 1), 2.0 * x), _mm_set1_pd(screenWidth)), one);
+    __m128d rayDirX = _mm_add_pd(_mm_set1_pd(camera.dirX), _mm_mul_pd(_mm_set1_pd(camera.planeX), cameraX));
+    __m128d rayDirY = _mm_add_pd(_mm_set1_pd(camera.dirY), _mm_mul_pd(_mm_set1_pd(camera.planeY), cameraX));
+    __m128d negX = _mm_cmplt_pd(rayDirX, zero);
+    __m128d negY = _mm_cmplt_pd(rayDirY, zero);
+
+    // (1 - step) / 2 is 1 where the ray points negative and 0 otherwise
+    __m128d perpX = _mm_div_pd(_mm_add_pd(_mm_sub_pd(_mm_cvtepi32_pd(mapX), posX), _mm_and_pd(negX, one)), rayDirX);
+    __m128d perpY = _mm_div_pd(_mm_add_pd(_mm_sub_pd(_mm_cvtepi32_pd(mapY), posY), _mm_and_pd(negY, one)), rayDirY);
+    // Widen the two low 32-bit side masks to 64-bit lanes
+    __m128d sideY64 = _mm_castsi128_pd(_mm_unpacklo_epi32(sideY, sideY));
+    __m128d perp = _mm_or_pd(_mm_and_pd(sideY64, perpY), _mm_andnot_pd(sideY64, perpX));
+
+    __m128d wallX = _mm_or_pd(_mm_and_pd(sideY64, _mm_add_pd(posX, _mm_mul_pd(perp, rayDirX))),
+                              _mm_andnot_pd(sideY64, _mm_add_pd(posY, _mm_mul_pd(perp, rayDirY))));
+    wallX = _mm_sub_pd(wallX, _mm_cvtepi32_pd(_mm_cvttpd_epi32(wallX)));
+    __m128i columns = _mm_cvttpd_epi32(_mm_mul_pd(wallX, _mm_set1_pd(texWidth)));
+
+    __m128d flip = _mm_or_pd(_mm_andnot_pd(sideY64, _mm_cmpgt_pd(rayDirX, zero)), _mm_and_pd(sideY64, negY));
+    // Narrow the 64-bit masks back to the two low 32-bit lanes
+    __m128i flip32 = _mm_shuffle_epi32(_mm_castpd_si128(flip), _MM_SHUFFLE(3, 3, 2, 0));
+    columns = _mm_or_si128(_mm_and_si128(flip32, _mm_sub_epi32(_mm_set1_epi32(texWidth - 1), columns)),
+                           _mm_andnot_si128(flip32, columns));
+
+    _mm_storeu_pd(perpWallDist, perp);
+    texX = columns;
+}
+
+// 4 adjacent columns per step in floats, with the same lane masking and
+// tolerance as the AVX2 kernel below. SSE2 has no gather, so the four cells
+// are read one by one from the padded table, and the kernel ends up no
+// faster than scalar; bestRayKernel() does not pick it.
+static void castRaysSSE2(const RayCamera& camera, int screenWidth, int firstColumn, int count,
+                         int texWidth, RayHits& hits) {
+    const int startMapX = int(camera.posX);
+    const int startMapY = int(camera.posY);
+    const unsigned char* cells = paddedSolidCells();
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 fracX = _mm_set1_ps((float)(camera.posX - startMapX));
+    const __m128 fracY = _mm_set1_ps((float)(camera.posY - startMapY));
+    const __m128 dirX = _mm_set1_ps((float)camera.dirX);
+    const __m128 dirY = _mm_set1_ps((float)camera.dirY);
+    const __m128 planeX = _mm_set1_ps((float)camera.planeX);
+    const __m128 planeY = _mm_set1_ps((float)camera.planeY);
+    const __m128 columnScale = _mm_set1_ps(2.0f / screenWidth);
+    const __m128 laneOffset = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    const __m128i oneEpi32 = _mm_set1_epi32(1);
+    const __m128i paddedHeight = _mm_set1_epi32(PADDED_HEIGHT);
+    const __m128i minusPaddedHeight = _mm_set1_epi32(-PADDED_HEIGHT);
+
+    const int end = firstColumn + count;
+    int x = firstColumn;
+    for (; x + 4 <= end; x += 4) {
+        __m128 column = _mm_add_ps(_mm_set1_ps((float)x), laneOffset);
+        __m128 cameraX = _mm_sub_ps(_mm_mul_ps(column, columnScale), one);
+        __m128 rayDirX = _mm_add_ps(dirX, _mm_mul_ps(planeX, cameraX));
+        __m128 rayDirY = _mm_add_ps(dirY, _mm_mul_ps(planeY, cameraX));
+
+        __m128 deltaDistX = _mm_andnot_ps(signBit, _mm_div_ps(one, rayDirX));
+        __m128 deltaDistY = _mm_andnot_ps(signBit, _mm_div_ps(one, rayDirY));
+
+        __m128 negX = _mm_cmplt_ps(rayDirX, zero);
+        __m128 negY = _mm_cmplt_ps(rayDirY, zero);
+        __m128 sideDistX = _mm_mul_ps(_mm_or_ps(_mm_and_ps(negX, fracX), _mm_andnot_ps(negX, _mm_sub_ps(one, fracX))), deltaDistX);
+        __m128 sideDistY = _mm_mul_ps(_mm_or_ps(_mm_and_ps(negY, fracY), _mm_andnot_ps(negY, _mm_sub_ps(one, fracY))), deltaDistY);
+
+        // Steps through the padded table: +-PADDED_HEIGHT in x, +-1 in y
+        __m128i stepX = _mm_or_si128(_mm_castps_si128(negX), oneEpi32);
+        __m128i stepY = _mm_or_si128(_mm_castps_si128(negY), oneEpi32);
+        __m128i stepIndexX = _mm_or_si128(_mm_and_si128(_mm_castps_si128(negX), minusPaddedHeight),
+                                          _mm_andnot_si128(_mm_castps_si128(negX), paddedHeight));
+        __m128i index = _mm_set1_epi32((startMapX + 1) * PADDED_HEIGHT + startMapY + 1);
+        __m128i mapX = _mm_set1_epi32(startMapX);
+        __m128i mapY = _mm_set1_epi32(startMapY);
+        __m128i sideY = _mm_setzero_si128();
+        __m128i active = _mm_set1_epi32(-1);
+
+        for (int i = 0; i < MAX_DDA_STEPS; i++) {
+            __m128i closerX = _mm_castps_si128(_mm_cmplt_ps(sideDistX, sideDistY));
+            __m128i moveX = _mm_and_si128(closerX, active);
+            __m128i moveY = _mm_andnot_si128(closerX, active);
+
+            sideDistX = _mm_add_ps(sideDistX, _mm_and_ps(_mm_castsi128_ps(moveX), deltaDistX));
+            sideDistY = _mm_add_ps(sideDistY, _mm_and_ps(_mm_castsi128_ps(moveY), deltaDistY));
+            mapX = _mm_add_epi32(mapX, _mm_and_si128(moveX, stepX));
+            mapY = _mm_add_epi32(mapY, _mm_and_si128(moveY, stepY));
+            index = _mm_add_epi32(index, _mm_or_si128(_mm_and_si128(moveX, stepIndexX),
+                                                      _mm_and_si128(moveY, stepY)));
+            sideY = _mm_or_si128(_mm_andnot_si128(active, sideY), moveY);
+
+            __m128i solid = _mm_set_epi32(-cells[_mm_cvtsi128_si32(_mm_shuffle_epi32(index, 3))],
+                                          -cells[_mm_cvtsi128_si32(_mm_shuffle_epi32(index, 2))],
+                                          -cells[_mm_cvtsi128_si32(_mm_shuffle_epi32(index, 1))],
+                                          -cells[_mm_cvtsi128_si32(index)]);
+            active = _mm_andnot_si128(solid, active);
+            if (_mm_movemask_ps(_mm_castsi128_ps(active)) == 0)
+                break;
+        }
+
+        __m128i lowTexX, highTexX;
+        finishRaysSSE2(camera, screenWidth, x, texWidth, mapX, mapY, sideY, &hits.perpWallDist[x], lowTexX);
+        finishRaysSSE2(camera, screenWidth, x + 2, texWidth, _mm_shuffle_epi32(mapX, _MM_SHUFFLE(3, 2, 3, 2)),
+                       _mm_shuffle_epi32(mapY, _MM_SHUFFLE(3, 2, 3, 2)),
+                       _mm_shuffle_epi32(sideY, _MM_SHUFFLE(3, 2, 3, 2)), &hits.perpWallDist[x + 2], highTexX);
+
+        _mm_storeu_si128((__m128i*)&hits.side[x], _mm_and_si128(sideY, oneEpi32));
+        _mm_storeu_si128((__m128i*)&hits.mapX[x], mapX);
+        _mm_storeu_si128((__m128i*)&hits.mapY[x], mapY);
+        _mm_storeu_si128((__m128i*)&hits.texX[x], _mm_unpacklo_epi64(lowTexX, highTexX));
+    }
+
+    // Leftover columns that do not fill a whole vector
+    castRaysScalar(camera, screenWidth, x, end - x, texWidth, hits);
+}
+#endif
+
+#ifdef RAYKERNEL_HAVE_AVX2
+// finishRay for columns [x, x + 4), one double operation for each of the
+// scalar ones so the results match it bit for bit
+__attribute__((target("avx2"))) static inline void finishRaysAVX2(const RayCamera& camera,
+                                                                  int screenWidth, int x, int texWidth,
+                                                                  __m128i mapX, __m128i mapY,
+                                                                  __m128i side, RayHits& hits) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d posX = _mm256_set1_pd(camera.posX);
+    const __m256d posY = _mm256_set1_pd(camera.posY);
+
+    __m256d twiceColumn = _mm256_set_pd(2.0 * (x + 3), 2.0 * (x + 2), 2.0 * (x + 1), 2.0 * x);
+    __m256d cameraX = _mm256_sub_pd(_mm256_div_pd(twiceColumn, _mm256_set1_pd(screenWidth)), one);
+    __m256d rayDirX = _mm256_add_pd(_mm256_set1_pd(camera.dirX),
+                                    _mm256_mul_pd(_mm256_set1_pd(camera.planeX), cameraX));
+    __m256d rayDirY = _mm256_add_pd(_mm256_set1_pd(camera.dirY),
+                                    _mm256_mul_pd(_mm256_set1_pd(camera.planeY), cameraX));
+    __m256d negX = _mm256_cmp_pd(rayDirX, zero, _CMP_LT_OQ);
+    __m256d negY = _mm256_cmp_pd(rayDirY, zero, _CMP_LT_OQ);
+
+    // (1 - step) / 2 is 1 where the ray points negative and 0 otherwise
+    __m256d perpX = _mm256_div_pd(
+        _mm256_add_pd(_mm256_sub_pd(_mm256_cvtepi32_pd(mapX), posX), _mm256_and_pd(negX, one)), rayDirX);
+    __m256d perpY = _mm256_div_pd(
+        _mm256_add_pd(_mm256_sub_pd(_mm256_cvtepi32_pd(mapY), posY), _mm256_and_pd(negY, one)), rayDirY);
+    __m128i sideY32 = _mm_cmpeq_epi32(side, _mm_set1_epi32(1));
+    __m256d sideY = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(sideY32));
+    __m256d perpWallDist = _mm256_blendv_pd(perpX, perpY, sideY);
+
+    __m256d wallX = _mm256_blendv_pd(_mm256_add_pd(posY, _mm256_mul_pd(perpWallDist, rayDirY)),
+                                     _mm256_add_pd(posX, _mm256_mul_pd(perpWallDist, rayDirX)), sideY);
+    wallX = _mm256_sub_pd(wallX, _mm256_floor_pd(wallX));
+
+    __m128i texX = _mm256_cvttpd_epi32(_mm256_mul_pd(wallX, _mm256_set1_pd(texWidth)));
+    __m256d flip = _mm256_or_pd(_mm256_andnot_pd(sideY, _mm256_cmp_pd(rayDirX, zero, _CMP_GT_OQ)),
+                                _mm256_and_pd(sideY, negY));
+    // Narrow the 64-bit lane mask to the 32-bit texX lanes
+    __m128i flip32 = _mm256_castsi256_si128(
+        _mm256_permutevar8x32_epi32(_mm256_castpd_si256(flip), _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0)));
+    texX = _mm_blendv_epi8(texX, _mm_sub_epi32(_mm_set1_epi32(texWidth - 1), texX), flip32);
+
+    _mm256_storeu_pd(&hits.perpWallDist[x], perpWallDist);
+    _mm_storeu_si128((__m128i*)&hits.side[x], side);
+    _mm_storeu_si128((__m128i*)&hits.mapX[x], mapX);
+    _mm_storeu_si128((__m128i*)&hits.mapY[x], mapY);
+    _mm_storeu_si128((__m128i*)&hits.texX[x], texX);
+}
+
+// 8 adjacent columns per step in floats. Lanes that have hit a wall are masked
+// off and keep their cell while the others keep stepping, and a hardware
+// gather does the map lookups. Only the DDA runs in floats: a ray that passes
+// within float precision of a wall corner may stop in the neighbouring cell of
+// the corner, which moves its distance by about that precision and its texture
+// column to the other edge of the wall. raybench checks this stays rare.
+__attribute__((target("avx2"))) static void castRaysAVX2(const RayCamera& camera, int screenWidth,
+                                                         int firstColumn, int count, int texWidth,
+                                                         RayHits& hits) {
+    const int startMapX = int(camera.posX);
+    const int startMapY = int(camera.posY);
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 fracX = _mm256_set1_ps((float)(camera.posX - startMapX));
+    const __m256 fracY = _mm256_set1_ps((float)(camera.posY - startMapY));
+    const __m256 dirX = _mm256_set1_ps((float)camera.dirX);
+    const __m256 dirY = _mm256_set1_ps((float)camera.dirY);
+    const __m256 planeX = _mm256_set1_ps((float)camera.planeX);
+    const __m256 planeY = _mm256_set1_ps((float)camera.planeY);
+    const __m256 columnScale = _mm256_set1_ps(2.0f / screenWidth);
+    const __m256 laneOffset = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    const __m256i oneEpi32 = _mm256_set1_epi32(1);
+    const __m256i zeroEpi32 = _mm256_setzero_si256();
+    const __m256i mapWidth = _mm256_set1_epi32(MAP_WIDTH);
+    const __m256i mapHeight = _mm256_set1_epi32(MAP_HEIGHT);
+    const int* cells = &worldMap[0][0];
+
+    const int end = firstColumn + count;
+    int x = firstColumn;
+    for (; x + 8 <= end; x += 8) {
+        __m256 column = _mm256_add_ps(_mm256_set1_ps((float)x), laneOffset);
+        __m256 cameraX = _mm256_sub_ps(_mm256_mul_ps(column, columnScale), one);
+        __m256 rayDirX = _mm256_add_ps(dirX, _mm256_mul_ps(planeX, cameraX));
+        __m256 rayDirY = _mm256_add_ps(dirY, _mm256_mul_ps(planeY, cameraX));
+
+        __m256 deltaDistX = _mm256_andnot_ps(signBit, _mm256_div_ps(one, rayDirX));
+        __m256 deltaDistY = _mm256_andnot_ps(signBit, _mm256_div_ps(one, rayDirY));
+
+        __m256 negX = _mm256_cmp_ps(rayDirX, zero, _CMP_LT_OQ);
+        __m256 negY = _mm256_cmp_ps(rayDirY, zero, _CMP_LT_OQ);
+        __m256i stepX = _mm256_or_si256(_mm256_castps_si256(negX), oneEpi32);
+        __m256i stepY = _mm256_or_si256(_mm256_castps_si256(negY), oneEpi32);
+
+        __m256 sideDistX = _mm256_mul_ps(_mm256_blendv_ps(_mm256_sub_ps(one, fracX), fracX, negX), deltaDistX);
+        __m256 sideDistY = _mm256_mul_ps(_mm256_blendv_ps(_mm256_sub_ps(one, fracY), fracY, negY), deltaDistY);
+
+        __m256i mapX = _mm256_set1_epi32(startMapX);
+        __m256i mapY = _mm256_set1_epi32(startMapY);
+        __m256i side = zeroEpi32;
+        __m256i active = _mm256_set1_epi32(-1);
+
+        for (int i = 0; i < MAX_DDA_STEPS; i++) {
+            if (_mm256_movemask_ps(_mm256_castsi256_ps(active)) == 0)
+                break;
+
+            __m256i closerX = _mm256_castps_si256(_mm256_cmp_ps(sideDistX, sideDistY, _CMP_LT_OQ));
+            __m256i moveX = _mm256_and_si256(closerX, active);
+            __m256i moveY = _mm256_andnot_si256(closerX, active);
+
+            sideDistX = _mm256_add_ps(sideDistX, _mm256_and_ps(_mm256_castsi256_ps(moveX), deltaDistX));
+            sideDistY = _mm256_add_ps(sideDistY, _mm256_and_ps(_mm256_castsi256_ps(moveY), deltaDistY));
+            mapX = _mm256_add_epi32(mapX, _mm256_and_si256(moveX, stepX));
+            mapY = _mm256_add_epi32(mapY, _mm256_and_si256(moveY, stepY));
+            side = _mm256_or_si256(_mm256_andnot_si256(active, side), _mm256_and_si256(moveY, oneEpi32));
+
+            // Cells outside the map count as solid and gather from index 0
+            __m256i outside = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpgt_epi32(zeroEpi32, mapX), _mm256_cmpgt_epi32(mapX, _mm256_sub_epi32(mapWidth, oneEpi32))),
+                _mm256_or_si256(_mm256_cmpgt_epi32(zeroEpi32, mapY), _mm256_cmpgt_epi32(mapY, _mm256_sub_epi32(mapHeight, oneEpi32))));
+            __m256i index = _mm256_andnot_si256(outside, _mm256_add_epi32(_mm256_mullo_epi32(mapX, mapHeight), mapY));
+            __m256i cell = _mm256_i32gather_epi32(cells, index, 4);
+            __m256i solid = _mm256_or_si256(outside, _mm256_cmpgt_epi32(cell, zeroEpi32));
+            active = _mm256_andnot_si256(solid, active);
+        }
+
+        finishRaysAVX2(camera, screenWidth, x, texWidth, _mm256_castsi256_si128(mapX),
+                       _mm256_castsi256_si128(mapY), _mm256_castsi256_si128(side), hits);
+        finishRaysAVX2(camera, screenWidth, x + 4, texWidth, _mm256_extracti128_si256(mapX, 1),
+                       _mm256_extracti128_si256(mapY, 1), _mm256_extracti128_si256(side, 1), hits);
+    }
+
+    castRaysScalar(camera, screenWidth, x, end - x, texWidth, hits);
+}
+#endif
+
+bool rayKernelSupported(RayKernelType kernel) {
+    switch (kernel) {
+    case RAY_KERNEL_SCALAR:
+        return true;
+    case RAY_KERNEL_SSE2:
+#ifdef RAYKERNEL_HAVE_SSE2
+        return true;
+#else
+        return false;
+#endif
+    case RAY_KERNEL_AVX2:
+#ifdef RAYKERNEL_HAVE_AVX2
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+RayKernelType bestRayKernel() {
+    if (rayKernelSupported(RAY_KERNEL_AVX2))
+        return RAY_KERNEL_AVX2;
+    return RAY_KERNEL_SCALAR;
+}
+
+const char* rayKernelName(RayKernelType kernel) {
+    switch (kernel) {
+    case RAY_KERNEL_SCALAR:
+        return "scalar";
+    case RAY_KERNEL_SSE2:
+        return "sse2";
+    case RAY_KERNEL_AVX2:
+        return "avx2";
+    }
+    return "unknown";
+}
+
+void castRays(RayKernelType kernel, const RayCamera& camera, int screenWidth, int firstColumn,
+              int count, int texWidth, RayHits& hits) {
+    switch (kernel) {
+#ifdef RAYKERNEL_HAVE_AVX2
+    case RAY_KERNEL_AVX2:
+        castRaysAVX2(camera, screenWidth, firstColumn, count, texWidth, hits);
+        return;
+#endif
+#ifdef RAYKERNEL_HAVE_SSE2
+    case RAY_KERNEL_SSE2:
+        castRaysSSE2(camera, screenWidth, firstColumn, count, texWidth, hits);
+        return;
+#endif
+    default:
+        castRaysScalar(camera, screenWidth, firstColumn, count, texWidth, hits);
+        return;
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef RAYKERNEL_H
+#define RAYKERNEL_H
+
+#include <vector>
+
+// Camera pose the rays are cast from (same fields as PlayerState)
+struct RayCamera {
+    double posX, posY;
+    double dirX, dirY;
+    double planeX, planeY;
+};
+
+// Per-column DDA results, structure-of-arrays so SIMD lanes store directly
+struct RayHits {
+    std::vector<double> perpWallDist;
+    std::vector<int> side; // 0 = hit an x-side, 1 = hit a y-side
+    std::vector<int> mapX;
+    std::vector<int> mapY;
+    std::vector<int> texX;
+
+    void resize(int columns);
+};
+
+enum RayKernelType {
+    RAY_KERNEL_SCALAR, // One ray at a time in doubles, the reference path
+    RAY_KERNEL_SSE2,   // 4 columns per step, see castRaysSSE2 for its tolerance
+    RAY_KERNEL_AVX2    // 8 columns per step, see castRaysAVX2 for its tolerance
+};
+
+// Function prototypes
+// Fastest wall kernel the CPU can run. The SSE2 kernel does not beat the
+// scalar one in raybench, so without AVX2 walls are cast in scalar.
+RayKernelType bestRayKernel();
+bool rayKernelSupported(RayKernelType kernel);
+const char* rayKernelName(RayKernelType kernel);
+
+// Cast columns [firstColumn, firstColumn + count) of a screenWidth wide view.
+// Results are written at the same column indices of `hits`.
+void castRays(RayKernelType kernel, const RayCamera& camera, int screenWidth,
+              int firstColumn, int count, int texWidth, RayHits& hits);
+
+#endif
@@ -0,0 +1,270 @@
+#include "Raycaster.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+
+Raycaster::Raycaster(int width, int height)
+    : width(width), height(height), zBuffer(width, 1e30), floorTexture(-1), ceilingTexture(-1),
+      wallKernel(bestRayKernel()), floorKernel(bestFloorKernel()), pool(nullptr) {
+    hits.resize(width);
+}
+
+void Raycaster::setResolution(int newWidth, int newHeight) {
+    width = newWidth;
+    height = newHeight;
+    zBuffer.resize(width);
+    hits.resize(width);
+}
+
+void Raycaster::setRayKernel(RayKernelType type) {
+    wallKernel = floorKernel = rayKernelSupported(type) ? type : RAY_KERNEL_SCALAR;
+    std::cout << "Ray kernel: " << rayKernelName(wallKernel) << std::endl;
+}
+
+void Raycaster::setThreadPool(ThreadPool* threadPool) {
+    pool = threadPool;
+}
+
+void Raycaster::setWallTextures(const TextureStore& textures) {
+    wallTextures = textures;
+}
+
+void Raycaster::setFloorTextures(int floor, int ceiling) {
+    floorTexture = floor;
+    ceilingTexture = ceiling;
+}
+
+bool Raycaster::hasFloorTextures() const {
+    return floorTexture >= 0 && floorTexture < wallTextures.count() && ceilingTexture >= 0 &&
+           ceilingTexture < wallTextures.count();
+}
+
+void Raycaster::drawWalls(const PlayerState& camera, Framebuffer& fb) {
+    PROFILE_SCOPE("walls");
+    RayCamera rayCamera = {camera.posX,  camera.posY,   camera.dirX,
+                           camera.dirY,  camera.planeX, camera.planeY};
+
+    // Floor and ceiling first, a scanline at a time; the walls then overwrite
+    // their own spans
+    frameStats = RaycasterStats();
+    frameStats.rays = width;
+
+    bool castFloor = hasFloorTextures();
+    if (castFloor) {
+        FloorTextures textures = {&wallTextures, floorTexture, ceilingTexture};
+        int rows = floorRowCount(height);
+        frameStats.floorTexels = 2L * rows * width;
+        if (pool) {
+            pool->parallelFor(rows, ROW_TILE_HEIGHT, [&](int begin, int end) {
+                PROFILE_SCOPE("floor tile");
+                castFloorRows(floorKernel, rayCamera, width, height, begin, end, textures,
+                              fb.pixels.data());
+            });
+        } else {
+            castFloorRows(floorKernel, rayCamera, width, height, 0, rows, textures, fb.pixels.data());
+        }
+    }
+
+    if (!pool) {
+        frameStats.wallTexels = drawColumns(rayCamera, 0, width, !castFloor, fb);
+        return;
+    }
+
+    // Columns are independent until the sprite pass, so tiles of them run
+    // on the pool and parallelFor joins before we return
+    std::atomic<long> wallTexels(0);
+    pool->parallelFor(width, COLUMN_TILE_WIDTH, [&](int begin, int end) {
+        PROFILE_SCOPE("wall tile");
+        wallTexels += drawColumns(rayCamera, begin, end, !castFloor, fb);
+    });
+    frameStats.wallTexels = wallTexels;
+}
+
+// Cast and draw columns [begin, end). Without a floor pass the background
+// above and below the wall is filled too, so a tile owns every pixel it
+// touches.
+long Raycaster::drawColumns(const RayCamera& camera, int begin, int end, bool fillBackground,
+                            Framebuffer& fb) {
+    const int numTextures = wallTextures.count();
+    const int maxWidthShift = wallTextures.maxWidthShift();
+    const Uint32 background = 0xFF000000;
+    long texels = 0;
+
+    castRays(wallKernel, camera, width, begin, end - begin, 1 << maxWidthShift, hits);
+
+    for (int x = begin; x < end; x++) {
+        double perpWallDist = hits.perpWallDist[x];
+        int mapX = hits.mapX[x];
+        int mapY = hits.mapY[x];
+
+        // Store in zBuffer for sprite rendering
+        zBuffer[x] = perpWallDist;
+
+        int lineHeight = (int)(height / perpWallDist);
+        int drawStart = -lineHeight / 2 + height / 2;
+        if (drawStart < 0)
+            drawStart = 0;
+        int drawEnd = lineHeight / 2 + height / 2;
+        if (drawEnd >= height)
+            drawEnd = height - 1;
+
+        // Choose texture based on wall type (1-4)
+        int texNum = 0;
+        if (mapX >= 0 && mapX < MAP_WIDTH && mapY >= 0 && mapY < MAP_HEIGHT)
+            texNum = worldMap[mapX][mapY] - 1;
+        texNum = std::max(0, std::min(numTextures - 1, texNum));
+        int texHeight = wallTextures.height(texNum);
+        int texX = hits.texX[x] >> (maxWidthShift - wallTextures.widthShift(texNum));
+        // Sequential texels of this wall column
+        const Uint32* texColumn = wallTextures.column(texNum, texX);
+
+        double step = 1.0 * texHeight / lineHeight;
+        double texPos = (drawStart - height / 2 + lineHeight / 2) * step;
+
+        // Walk the texture column straight into the framebuffer
+        Uint32* dst = fb.pixels.data() + x;
+        if (fillBackground) {
+            for (int y = 0; y < drawStart; y++) {
+                *dst = background;
+                dst += fb.width;
+            }
+        } else {
+            dst += drawStart * fb.width;
+        }
+        for (int y = drawStart; y < drawEnd; y++) {
+            int texY = (int)texPos & (texHeight - 1);
+            texPos += step;
+            *dst = texColumn[texY];
+            dst += fb.width;
+        }
+        for (int y = drawEnd; y < height && fillBackground; y++) {
+            *dst = background;
+            dst += fb.width;
+        }
+        texels += std::max(0, drawEnd - drawStart);
+    }
+    return texels;
+}
+
+void Raycaster::drawSprites(const PlayerState& camera, const std::vector<Sprite>& sprites,
+                            Framebuffer& fb) {
+    PROFILE_SCOPE("sprites");
+    double invDet = 1.0 / (camera.planeX * camera.dirY - camera.dirX * camera.planeY);
+
+    // Project every sprite once
+    projected.clear();
+    for (const auto& sprite : sprites) {
+        double spriteX = sprite.x - camera.posX;
+        double spriteY = sprite.y - camera.posY;
+
+        double transformX = invDet * (camera.dirY * spriteX - camera.dirX * spriteY);
+        double transformY = invDet * (-camera.planeY * spriteX + camera.planeX * spriteY);
+
+        if (transformY <= 0)
+            continue; // Don't draw if behind the player
+
+        int spriteScreenX = int((width / 2) * (1 + transformX / transformY));
+
+        int spriteHeight = std::abs(int(height / transformY)); // Scale with distance
+        if (spriteHeight == 0 || sprite.frame.w == 0 || sprite.frame.h == 0)
+            continue;
+
+        ProjectedSprite p;
+        p.sprite = &sprite;
+        p.depth = transformY;
+        p.size = spriteHeight; // Maintain square proportions
+        // Unclamped bounds keep the texture mapping stable when partly off screen
+        p.top = -spriteHeight / 2 + height / 2;
+        p.left = -spriteHeight / 2 + spriteScreenX;
+        p.drawStartY = std::max(0, p.top);
+        p.drawEndY = std::min(height - 1, spriteHeight / 2 + height / 2);
+        p.drawStartX = std::max(0, p.left);
+        p.drawEndX = std::min(width - 1, spriteHeight / 2 + spriteScreenX);
+        if (p.drawStartX < p.drawEndX && p.drawStartY < p.drawEndY)
+            projected.push_back(p);
+    }
+
+    std::sort(projected.begin(), projected.end(),
+              [](const ProjectedSprite& a, const ProjectedSprite& b) {
+                  return a.depth > b.depth; // Furthest first
+              });
+
+    // One sweep over each sprite's columns against the zBuffer, keeping
+    // only the runs that are in front of the walls
+    spans.clear();
+    for (int i = 0; i < (int)projected.size(); i++) {
+        const ProjectedSprite& p = projected[i];
+        int runStart = -1;
+        for (int x = p.drawStartX; x < p.drawEndX; x++) {
+            bool visible = p.depth < zBuffer[x];
+            if (visible && runStart < 0) {
+                runStart = x;
+            } else if (!visible && runStart >= 0) {
+                SpriteSpan span = {i, runStart, x};
+                spans.push_back(span);
+                runStart = -1;
+            }
+        }
+        if (runStart >= 0) {
+            SpriteSpan span = {i, runStart, p.drawEndX};
+            spans.push_back(span);
+        }
+    }
+
+    if (spans.empty())
+        return;
+
+    for (const SpriteSpan& span : spans) {
+        const ProjectedSprite& p = projected[span.sprite];
+        frameStats.spriteTexels += (long)(span.end - span.begin) * (p.drawEndY - p.drawStartY);
+    }
+
+    // Draw all spans as one batch. Column tiles are independent and keep the
+    // far-to-near order of the span list, so they can run on the pool.
+    if (pool) {
+        pool->parallelFor(width, COLUMN_TILE_WIDTH,
+                          [&](int begin, int end) {
+                              PROFILE_SCOPE("sprite tile");
+                              drawSpriteSpans(begin, end, fb);
+                          });
+    } else {
+        drawSpriteSpans(0, width, fb);
+    }
+}
+
+// Blit the parts of every visible span that fall in columns [begin, end)
+void Raycaster::drawSpriteSpans(int begin, int end, Framebuffer& fb) {
+    for (const SpriteSpan& span : spans) {
+        int spanBegin = std::max(begin, span.begin);
+        int spanEnd = std::min(end, span.end);
+        if (spanBegin >= spanEnd)
+            continue;
+
+        const ProjectedSprite& p = projected[span.sprite];
+        const Sprite& sprite = *p.sprite;
+        const PixelImage& image = sprite.spriteSheet->image;
+        const SDL_Rect& frame = sprite.frame;
+
+        // 16.16 fixed-point texture row stepping, no division per pixel
+        int rowStep = (frame.h << 16) / p.size;
+        int rowStart = (p.drawStartY - p.top) * rowStep;
+
+        for (int stripe = spanBegin; stripe < spanEnd; stripe++) {
+            int column = (stripe - p.left) * frame.w / p.size;
+            int texX = sprite.flip ? frame.x + frame.w - column - 1 : frame.x + column;
+            const Uint32* texels = image.pixels.data() + frame.y * image.width + texX;
+
+            Uint32* dst = fb.pixels.data() + p.drawStartY * fb.width + stripe;
+            int row = rowStart;
+            for (int y = p.drawStartY; y < p.drawEndY; y++) {
+                Uint32 texel = texels[(row >> 16) * image.width];
+                if (texel & 0xFF000000) // Skip transparent texels
+                    *dst = texel;
+                row += rowStep;
+                dst += fb.width;
+            }
+        }
+    }
+}
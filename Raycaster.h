@@ -0,0 +1,93 @@
+#ifndef RAYCASTER_H
+#define RAYCASTER_H
+
+#include "FloorCaster.h"
+#include "Framebuffer.h"
+#include "RayKernel.h"
+#include "SpriteSheet.h"
+#include "TextureStore.h"
+#include "ThreadPool.h"
+#include "common.h"
+#include <vector>
+
+// Work done by the last frame, texels count every texture fetch
+struct RaycasterStats {
+    long rays = 0;
+    long wallTexels = 0;
+    long floorTexels = 0; // Floor and ceiling together
+    long spriteTexels = 0;
+};
+
+// Software raycaster: writes wall and sprite columns straight into a Framebuffer
+class Raycaster {
+public:
+    Raycaster(int width, int height);
+
+    // Change the number of rays and rows, must match the framebuffer size
+    void setResolution(int newWidth, int newHeight);
+
+    // Use one kernel for walls and floors, falling back to scalar if the CPU
+    // lacks the instruction set. By default each gets its fastest kernel.
+    void setRayKernel(RayKernelType type);
+    RayKernelType wallKernelType() const { return wallKernel; }
+    RayKernelType floorKernelType() const { return floorKernel; }
+    // Wall columns are split across the pool, nullptr draws on the caller
+    void setThreadPool(ThreadPool* threadPool);
+    void setWallTextures(const TextureStore& textures);
+    // Wall textures to reuse for the floor and ceiling, -1 leaves them black
+    void setFloorTextures(int floor, int ceiling);
+
+    void drawWalls(const PlayerState& camera, Framebuffer& fb);
+    // Clips sprites against the wall depths of the last drawWalls() call
+    void drawSprites(const PlayerState& camera, const std::vector<Sprite>& sprites, Framebuffer& fb);
+
+    // Reset by drawWalls(), completed by drawSprites()
+    const RaycasterStats& stats() const { return frameStats; }
+
+private:
+    // Tile width in columns, a multiple of the widest SIMD kernel
+    static const int COLUMN_TILE_WIDTH = 32;
+    // Floor rows per tile
+    static const int ROW_TILE_HEIGHT = 16;
+
+    // A sprite after projection to the screen
+    struct ProjectedSprite {
+        const Sprite* sprite;
+        double depth;          // Distance along the view direction
+        int size;              // On-screen width and height
+        int left, top;         // Unclamped top-left corner
+        int drawStartX, drawEndX;
+        int drawStartY, drawEndY;
+    };
+
+    // Run of adjacent columns where a sprite is in front of the walls
+    struct SpriteSpan {
+        int sprite; // Index into `projected`
+        int begin, end;
+    };
+
+    bool hasFloorTextures() const;
+    // Returns the number of wall texels drawn
+    long drawColumns(const RayCamera& camera, int begin, int end, bool fillBackground,
+                     Framebuffer& fb);
+    void drawSpriteSpans(int begin, int end, Framebuffer& fb);
+
+    int width;
+    int height;
+    std::vector<double> zBuffer; // Perpendicular wall distance per column
+    TextureStore wallTextures; // Column-major, indexed by wall type - 1
+    int floorTexture;
+    int ceilingTexture;
+    // Picked at runtime from the CPU features
+    RayKernelType wallKernel;
+    RayKernelType floorKernel;
+    RayHits hits;
+    ThreadPool* pool;
+    RaycasterStats frameStats;
+
+    // Reused every frame by the sprite pass
+    std::vector<ProjectedSprite> projected; // Furthest first
+    std::vector<SpriteSpan> spans;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#include "ResolutionScaler.h"
+#include <algorithm>
+#include <cmath>
+
+static const double MIN_SCALE = 0.4;
+static const double SMOOTHING = 0.1;       // Weight of the newest sample
+static const double HEADROOM = 0.85;       // Grow only below this share of the budget
+static const double GROW_STEP = 0.02;      // Scale added per step up
+static const double MAX_SHRINK_STEP = 0.1; // Scale removed at most per step down
+static const int COOLDOWN_FRAMES = 15;     // Frames to settle after a change
+static const int WIDTH_ALIGN = 8;          // Keep whole SIMD ray batches
+
+ResolutionScaler::ResolutionScaler(int maxWidth, int maxHeight, double budgetMs)
+    : maxWidth(maxWidth), maxHeight(maxHeight), budgetMs(budgetMs), averageMs(0.0),
+      currentScale(1.0), currentWidth(maxWidth), currentHeight(maxHeight), cooldown(0) {}
+
+bool ResolutionScaler::update(double renderMs) {
+    if (budgetMs <= 0.0)
+        return false;
+
+    averageMs = averageMs == 0.0 ? renderMs : averageMs + SMOOTHING * (renderMs - averageMs);
+
+    if (cooldown > 0) {
+        cooldown--;
+        return false;
+    }
+
+    int oldWidth = currentWidth;
+    if (averageMs > budgetMs) {
+        // Cost grows with pixel count, i.e. with the square of the scale
+        double target = currentScale * std::sqrt(budgetMs / averageMs);
+        applyScale(std::max(target, currentScale - MAX_SHRINK_STEP));
+    } else if (averageMs < budgetMs * HEADROOM && currentScale < 1.0) {
+        applyScale(currentScale + GROW_STEP);
+    }
+
+    if (currentWidth == oldWidth)
+        return false;
+
+    // Let the average catch up with the new resolution before judging again
+    cooldown = COOLDOWN_FRAMES;
+    return true;
+}
+
+void ResolutionScaler::applyScale(double newScale) {
+    currentScale = std::max(MIN_SCALE, std::min(1.0, newScale));
+
+    int width = int(maxWidth * currentScale) / WIDTH_ALIGN * WIDTH_ALIGN;
+    currentWidth = std::max(WIDTH_ALIGN, std::min(maxWidth, width));
+    // Same aspect ratio as the window so the upscale is uniform
+    currentHeight = std::max(1, currentWidth * maxHeight / maxWidth);
+}
@@ -0,0 +1,32 @@
+#ifndef RESOLUTIONSCALER_H
+#define RESOLUTIONSCALER_H
+
+// Picks the internal render resolution from measured render times so the
+// frame stays inside a time budget. The result is upscaled to the window.
+class ResolutionScaler {
+public:
+    // budgetMs <= 0 turns scaling off and keeps the full resolution
+    ResolutionScaler(int maxWidth, int maxHeight, double budgetMs);
+
+    // Feed the time the last frame took to render. Returns true when the
+    // resolution changed and the renderer needs resizing.
+    bool update(double renderMs);
+
+    int width() const { return currentWidth; }
+    int height() const { return currentHeight; }
+    double scale() const { return currentScale; }
+
+private:
+    void applyScale(double newScale);
+
+    int maxWidth;
+    int maxHeight;
+    double budgetMs;
+    double averageMs;
+    double currentScale;
+    int currentWidth;
+    int currentHeight;
+    int cooldown;
+};
+
+#endif
@@ -0,0 +1,217 @@
+#include "SnapshotCodec.h"
+#include <cmath>
+#include <cstring>
+
+// Field changes are sent as "unchanged", a small signed difference or the
+// full value, whichever applies
+static const int SMALL_DELTA_BITS = 10;     // Position and angle, +-2 cells
+static const int SMALL_SEQUENCE_BITS = 8;   // Inputs applied since the baseline
+static const int BASELINE_AGE_BITS = 5;     // Ticks back, below SNAPSHOT_HISTORY
+static const int PLAYER_COUNT_BITS = 8;
+
+static const double TWO_PI = 6.283185307179586;
+
+bool NetPlayerState::operator==(const NetPlayerState& other) const {
+    return posX == other.posX && posY == other.posY && angle == other.angle &&
+           isMoving == other.isMoving && isAdmin == other.isAdmin && hidden == other.hidden &&
+           lastInput == other.lastInput;
+}
+
+SnapshotRing::SnapshotRing() {
+    clear();
+}
+
+void SnapshotRing::put(const NetSnapshot& snapshot) {
+    slots[snapshot.tick % SNAPSHOT_HISTORY] = snapshot;
+}
+
+const NetSnapshot* SnapshotRing::find(uint32_t tick) const {
+    const NetSnapshot& slot = slots[tick % SNAPSHOT_HISTORY];
+    if (tick == 0 || slot.tick != tick) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+void SnapshotRing::clear() {
+    memset(slots, 0, sizeof(slots));
+}
+
+static uint16_t quantizePosition(double value) {
+    double scaled = std::floor(value * POSITION_SCALE + 0.5);
+    if (scaled < 0.0) {
+        scaled = 0.0;
+    }
+    if (scaled > 65535.0) {
+        scaled = 65535.0;
+    }
+    return uint16_t(scaled);
+}
+
+NetPlayerState quantizePlayer(const PlayerState& state, uint32_t lastInput) {
+    NetPlayerState net;
+    net.posX = quantizePosition(state.posX);
+    net.posY = quantizePosition(state.posY);
+
+    // atan2 is in (-pi, pi]; wrap negative angles onto the top of the range
+    double turns = atan2(state.dirY, state.dirX) / TWO_PI;
+    long steps = lround(turns * (1 << ANGLE_BITS));
+    net.angle = uint16_t(steps & ((1 << ANGLE_BITS) - 1));
+
+    net.isMoving = state.isMoving;
+    net.isAdmin = state.isAdmin;
+    net.hidden = false;
+    net.lastInput = lastInput;
+    return net;
+}
+
+PlayerState dequantizePlayer(const NetPlayerState& net) {
+    PlayerState state;
+    state.posX = net.posX / POSITION_SCALE;
+    state.posY = net.posY / POSITION_SCALE;
+
+    double angle = net.angle * TWO_PI / (1 << ANGLE_BITS);
+    state.dirX = cos(angle);
+    state.dirY = sin(angle);
+    // The camera plane is always the direction turned a quarter clockwise
+    state.planeX = state.dirY * CAMERA_PLANE_LENGTH;
+    state.planeY = -state.dirX * CAMERA_PLANE_LENGTH;
+
+    state.isMoving = net.isMoving;
+    state.isAdmin = net.isAdmin;
+    return state;
+}
+
+// 16-bit fields wrap, so the angle difference across zero is still small
+static void writeField16(BitWriter& out, uint16_t value, uint16_t base) {
+    int16_t delta = int16_t(uint16_t(value - base));
+    if (delta == 0) {
+        out.writeBool(false);
+        return;
+    }
+    out.writeBool(true);
+    const int limit = 1 << (SMALL_DELTA_BITS - 1);
+    if (delta >= -limit && delta < limit) {
+        out.writeBool(false);
+        out.write(uint32_t(delta), SMALL_DELTA_BITS);
+    } else {
+        out.writeBool(true);
+        out.write(value, 16);
+    }
+}
+
+static uint16_t readField16(BitReader& in, uint16_t base) {
+    if (!in.readBool()) {
+        return base;
+    }
+    if (!in.readBool()) {
+        // Sign-extend the small difference
+        int32_t delta = int32_t(in.read(SMALL_DELTA_BITS));
+        if (delta & (1 << (SMALL_DELTA_BITS - 1))) {
+            delta -= 1 << SMALL_DELTA_BITS;
+        }
+        return uint16_t(base + delta);
+    }
+    return uint16_t(in.read(16));
+}
+
+// Input sequences only grow, so the difference is sent unsigned
+static void writeSequence(BitWriter& out, uint32_t value, uint32_t base) {
+    uint32_t delta = value - base;
+    if (delta == 0) {
+        out.writeBool(false);
+        return;
+    }
+    out.writeBool(true);
+    if (value > base && delta < (uint32_t(1) << SMALL_SEQUENCE_BITS)) {
+        out.writeBool(false);
+        out.write(delta, SMALL_SEQUENCE_BITS);
+    } else {
+        out.writeBool(true);
+        out.write(value, 32);
+    }
+}
+
+static uint32_t readSequence(BitReader& in, uint32_t base) {
+    if (!in.readBool()) {
+        return base;
+    }
+    if (!in.readBool()) {
+        return base + in.read(SMALL_SEQUENCE_BITS);
+    }
+    return in.read(32);
+}
+
+void encodeSnapshot(const NetSnapshot& snapshot, const NetSnapshot* baseline, BitWriter& out) {
+    if (baseline && (baseline->tick >= snapshot.tick ||
+                     snapshot.tick - baseline->tick >= SNAPSHOT_HISTORY)) {
+        baseline = nullptr;
+    }
+
+    out.write(snapshot.tick, 32);
+    out.writeBool(baseline != nullptr);
+    if (baseline) {
+        out.write(snapshot.tick - baseline->tick, BASELINE_AGE_BITS);
+    }
+    out.write(snapshot.numPlayers, PLAYER_COUNT_BITS);
+
+    NetPlayerState empty;
+    memset(&empty, 0, sizeof(empty));
+    for (size_t i = 0; i < snapshot.numPlayers; i++) {
+        const NetPlayerState& player = snapshot.players[i];
+        const NetPlayerState& base =
+            baseline && i < baseline->numPlayers ? baseline->players[i] : empty;
+        if (player == base) {
+            out.writeBool(false);
+            continue;
+        }
+        out.writeBool(true);
+        writeField16(out, player.posX, base.posX);
+        writeField16(out, player.posY, base.posY);
+        writeField16(out, player.angle, base.angle);
+        writeSequence(out, player.lastInput, base.lastInput);
+        out.writeBool(player.isMoving);
+        out.writeBool(player.isAdmin);
+        out.writeBool(player.hidden);
+    }
+    out.flush();
+}
+
+bool decodeSnapshot(BitReader& in, const SnapshotRing& history, NetSnapshot& out) {
+    memset(&out, 0, sizeof(out));
+    out.tick = in.read(32);
+
+    const NetSnapshot* baseline = nullptr;
+    if (in.readBool()) {
+        uint32_t age = in.read(BASELINE_AGE_BITS);
+        baseline = history.find(out.tick - age);
+        if (age == 0 || !baseline) {
+            return false;
+        }
+    }
+
+    out.numPlayers = uint8_t(in.read(PLAYER_COUNT_BITS));
+    if (out.numPlayers > MAX_SNAPSHOT_PLAYERS) {
+        return false;
+    }
+
+    NetPlayerState empty;
+    memset(&empty, 0, sizeof(empty));
+    for (size_t i = 0; i < out.numPlayers; i++) {
+        const NetPlayerState& base =
+            baseline && i < baseline->numPlayers ? baseline->players[i] : empty;
+        NetPlayerState& player = out.players[i];
+        player = base;
+        if (!in.readBool()) {
+            continue;
+        }
+        player.posX = readField16(in, base.posX);
+        player.posY = readField16(in, base.posY);
+        player.angle = readField16(in, base.angle);
+        player.lastInput = readSequence(in, base.lastInput);
+        player.isMoving = in.readBool();
+        player.isAdmin = in.readBool();
+        player.hidden = in.readBool();
+    }
+    return !in.overflowed() && out.tick != 0;
+}
@@ -0,0 +1,66 @@
+#ifndef SNAPSHOTCODEC_H
+#define SNAPSHOTCODEC_H
+
+#include "BitStream.h"
+#include "common.h"
+
+// Snapshots go over the wire quantized and bit-packed. Each one is encoded
+// against a baseline, an earlier snapshot the receiving client has
+// acknowledged, so a field that has not changed costs one bit and a small
+// change costs a few. Without a baseline everything is sent in full.
+
+const double POSITION_SCALE = 256.0; // Fixed-point steps per map cell
+const int POSITION_BITS = 16;        // Enough for maps up to 256 cells across
+const int ANGLE_BITS = 16;           // View direction, a full turn
+const double CAMERA_PLANE_LENGTH = 0.66; // Rebuilt from the direction
+const uint32_t SNAPSHOT_HISTORY = 32; // Ticks a baseline stays usable
+
+// One player's state as it is sent
+struct NetPlayerState {
+    uint16_t posX;
+    uint16_t posY;
+    uint16_t angle;
+    bool isMoving;
+    bool isAdmin;
+    // Out of the receiver's sight; the other fields are stale and the
+    // player should not be drawn
+    bool hidden;
+    uint32_t lastInput; // Sequence of the last input the server applied
+
+    bool operator==(const NetPlayerState& other) const;
+    bool operator!=(const NetPlayerState& other) const { return !(*this == other); }
+};
+
+// Every player's state after one server tick, as one client is told it
+struct NetSnapshot {
+    uint32_t tick; // 0 = not a real snapshot
+    uint8_t numPlayers;
+    NetPlayerState players[MAX_SNAPSHOT_PLAYERS];
+};
+
+// The last SNAPSHOT_HISTORY snapshots, looked up by tick
+class SnapshotRing {
+public:
+    SnapshotRing();
+
+    void put(const NetSnapshot& snapshot);
+    // nullptr once the snapshot has been overwritten or if it never existed
+    const NetSnapshot* find(uint32_t tick) const;
+    void clear();
+
+private:
+    NetSnapshot slots[SNAPSHOT_HISTORY];
+};
+
+// Function prototypes
+NetPlayerState quantizePlayer(const PlayerState& state, uint32_t lastInput);
+PlayerState dequantizePlayer(const NetPlayerState& net);
+
+// Encode snapshot against baseline, or in full if baseline is nullptr. The
+// baseline must be from an earlier tick within SNAPSHOT_HISTORY.
+void encodeSnapshot(const NetSnapshot& snapshot, const NetSnapshot* baseline, BitWriter& out);
+// Decode a snapshot, looking its baseline up in history. Returns false if
+// the data is malformed or the baseline is no longer there.
+bool decodeSnapshot(BitReader& in, const SnapshotRing& history, NetSnapshot& out);
+
+#endif
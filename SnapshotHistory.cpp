@@ -0,0 +1,66 @@
+#include "SnapshotHistory.h"
+#include <cmath>
+
+void SnapshotHistory::push(double time, const PlayerState& state) {
+    if (!states.empty() && time < states.back().time) {
+        return;
+    }
+    states.push_back({time, state});
+    if (states.size() > MAX_STATES) {
+        states.pop_front();
+    }
+}
+
+// Rotate a direction or camera plane vector by an angle in radians
+static void rotate(double& x, double& y, double angle) {
+    double c = cos(angle);
+    double s = sin(angle);
+    double oldX = x;
+    x = x * c - y * s;
+    y = oldX * s + y * c;
+}
+
+bool SnapshotHistory::sample(double renderTime, PlayerState& out) const {
+    if (states.empty()) {
+        return false;
+    }
+    if (renderTime <= states.front().time) {
+        out = states.front().state;
+        return true;
+    }
+    if (renderTime >= states.back().time) {
+        out = states.back().state;
+        return true;
+    }
+
+    // Newest snapshot at or before renderTime; the history is short so a
+    // backwards scan is cheaper than a binary search
+    size_t i = states.size() - 1;
+    while (states[i].time > renderTime) {
+        i--;
+    }
+    const TimedState& from = states[i];
+    const TimedState& to = states[i + 1];
+    double span = to.time - from.time;
+    double f = span > 0.0 ? (renderTime - from.time) / span : 1.0;
+    out = interpolateState(from.state, to.state, f);
+    return true;
+}
+
+PlayerState interpolateState(const PlayerState& from, const PlayerState& to, double f) {
+    PlayerState out = to;
+    out.posX = from.posX + (to.posX - from.posX) * f;
+    out.posY = from.posY + (to.posY - from.posY) * f;
+
+    // Turn the older direction part of the way towards the newer one, the
+    // short way round, and the camera plane with it
+    double angle = atan2(from.dirX * to.dirY - from.dirY * to.dirX,
+                         from.dirX * to.dirX + from.dirY * to.dirY);
+    out.dirX = from.dirX;
+    out.dirY = from.dirY;
+    out.planeX = from.planeX;
+    out.planeY = from.planeY;
+    rotate(out.dirX, out.dirY, angle * f);
+    rotate(out.planeX, out.planeY, angle * f);
+    return out;
+}
@@ -0,0 +1,42 @@
+#ifndef SNAPSHOTHISTORY_H
+#define SNAPSHOTHISTORY_H
+
+#include "common.h"
+#include <deque>
+
+// A player state as it was at a point in time (seconds)
+struct TimedState {
+    double time;
+    PlayerState state;
+};
+
+// Function prototypes
+// State a fraction f of the way from `from` to `to` (0 = from, 1 = to)
+PlayerState interpolateState(const PlayerState& from, const PlayerState& to, double f);
+
+// Short history of server states for one remote player. Remote players are
+// drawn a fixed delay in the past, between the two states around that time,
+// so they move smoothly whatever the packet timing.
+class SnapshotHistory {
+public:
+    // States older than the newest one are ignored
+    void push(double time, const PlayerState& state);
+    void clear() { states.clear(); }
+    bool empty() const { return states.empty(); }
+    // nullptr if there is no history yet
+    const TimedState* newest() const { return states.empty() ? nullptr : &states.back(); }
+
+    // State at renderTime, interpolated between the surrounding snapshots.
+    // Before the oldest or after the newest snapshot the nearest one is held.
+    // Returns false if there is no history yet.
+    bool sample(double renderTime, PlayerState& out) const;
+
+private:
+    // Enough for about a second of snapshots at 60 Hz, far more than the
+    // interpolation delay needs
+    static const size_t MAX_STATES = 64;
+
+    std::deque<TimedState> states; // Oldest first
+};
+
+#endif
@@ -62,6 +62,18 @@ SpriteSheet loadSpriteSheet(SDL_Renderer* renderer, const std::string& infoFile,
     }
 
 
+    // Keep a CPU copy of the pixels with the transparent color keyed out
+    sheet.image = loadPixelImage(tempSurface);
+    if (sheet.useTransparency) {
+        Uint32 key = 0xFF000000 | (sheet.transparentColor.r << 16) |
+                     (sheet.transparentColor.g << 8) | sheet.transparentColor.b;
+        for (Uint32& texel : sheet.image.pixels) {
+            if (texel == key) {
+                texel = 0;
+            }
+        }
+    }
+
     // Convert surface to texture
     sheet.texture = SDL_CreateTextureFromSurface(renderer, tempSurface);
     SDL_FreeSurface(tempSurface);
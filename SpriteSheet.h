@@ -4,15 +4,19 @@
 #include <SDL2/SDL.h>
 #include <vector>
 #include <string>
+#include "Framebuffer.h"
 
 // Structure to handle a single sprite instance
 struct Sprite {
     double x, y, distance;
     struct SpriteSheet* spriteSheet;  // Pointer to SpriteSheet
     int playerIndex;
+    SDL_Rect frame;   // Frame of the sheet to draw
+    bool flip;        // Mirror the frame horizontally
 
     Sprite(double x, double y, double dist, SpriteSheet* sheet, int index)
-        : x(x), y(y), distance(dist), spriteSheet(sheet), playerIndex(index) {}
+        : x(x), y(y), distance(dist), spriteSheet(sheet), playerIndex(index),
+          frame(), flip(false) {}
 };
 
 // Structure to handle an entire sprite sheet
@@ -23,6 +27,7 @@ struct SpriteSheet {
     bool useTransparency;
     SDL_Color transparentColor;
     std::vector<SDL_Rect> frames; // Store individual frame rects
+    PixelImage image;             // CPU copy for the software renderer, transparent texels have alpha 0
 };
 
 // Function prototypes
@@ -0,0 +1,68 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded single-producer single-consumer queue. One thread may push and one
+// other thread may pop without locks; each side only writes its own index
+// and keeps a cached copy of the other one to avoid touching its cache line
+// on every call.
+template <typename T>
+class SpscQueue {
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscQueue(size_t capacity) : head(0), cachedTail(0), tail(0), cachedHead(0) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer side. Returns false when the queue is full.
+    bool push(const T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead > mask) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead > mask) {
+                return false;
+            }
+        }
+        slots[t & mask] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when the queue is empty.
+    bool pop(T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) {
+                return false;
+            }
+        }
+        item = slots[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::vector<T> slots;
+    size_t mask;
+
+    // Indices only grow. Each side's index shares a cache line with that
+    // side's copy of the other index, so a call normally touches one line.
+    alignas(64) std::atomic<size_t> head; // Next slot to pop, written by the consumer
+    size_t cachedTail;                    // Consumer's view of tail
+    alignas(64) std::atomic<size_t> tail; // Next slot to push, written by the producer
+    size_t cachedHead;                    // Producer's view of head
+};
+
+#endif
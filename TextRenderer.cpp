@@ -0,0 +1,158 @@
+#include "TextRenderer.h"
+#include <SDL2/SDL_ttf.h>
+#include <algorithm>
+#include <iostream>
+
+TextRenderer::TextRenderer(SDL_Renderer* renderer, const std::string& fontFile, int pointSize)
+    : renderer(renderer), atlas(nullptr), atlasWidth(0), atlasHeight(0), lineSkip(0) {
+    for (Glyph& glyph : glyphs) {
+        glyph.source = {0, 0, 0, 0};
+        glyph.advance = 0;
+    }
+    buildAtlas(fontFile, pointSize);
+}
+
+TextRenderer::~TextRenderer() {
+    if (atlas) {
+        SDL_DestroyTexture(atlas);
+    }
+}
+
+void TextRenderer::buildAtlas(const std::string& fontFile, int pointSize) {
+    TTF_Font* font = TTF_OpenFont(fontFile.c_str(), pointSize);
+    if (!font) {
+        std::cerr << "Failed to load font: " << TTF_GetError() << std::endl;
+        return;
+    }
+    lineSkip = TTF_FontLineSkip(font);
+
+    // Rasterize every glyph and pack them into rows, leaving a pixel of
+    // padding so filtering never picks up a neighbour
+    const SDL_Color white = {255, 255, 255, 255};
+    std::vector<SDL_Surface*> surfaces(LAST_GLYPH - FIRST_GLYPH + 1, nullptr);
+    int penX = 1, penY = 1, rowHeight = 0;
+    for (int c = FIRST_GLYPH; c <= LAST_GLYPH; c++) {
+        Glyph& glyph = glyphs[c - FIRST_GLYPH];
+        int minX, maxX, minY, maxY;
+        if (TTF_GlyphMetrics(font, (Uint16)c, &minX, &maxX, &minY, &maxY, &glyph.advance) != 0) {
+            continue;
+        }
+
+        SDL_Surface* surface = TTF_RenderGlyph_Blended(font, (Uint16)c, white);
+        if (!surface) {
+            continue; // Blank glyphs such as space only advance the pen
+        }
+        if (penX + surface->w + 1 > ATLAS_WIDTH) {
+            penX = 1;
+            penY += rowHeight + 1;
+            rowHeight = 0;
+        }
+        glyph.source = {penX, penY, surface->w, surface->h};
+        penX += surface->w + 1;
+        rowHeight = std::max(rowHeight, surface->h);
+        surfaces[c - FIRST_GLYPH] = surface;
+    }
+    TTF_CloseFont(font);
+
+    atlasWidth = ATLAS_WIDTH;
+    atlasHeight = penY + rowHeight + 1;
+    SDL_Surface* atlasSurface =
+        SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    for (size_t i = 0; i < surfaces.size(); i++) {
+        if (!surfaces[i]) {
+            continue;
+        }
+        if (atlasSurface) {
+            // Copy the coverage into the alpha channel instead of blending it
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(surfaces[i], NULL, atlasSurface, &glyphs[i].source);
+        }
+        SDL_FreeSurface(surfaces[i]);
+    }
+
+    if (!atlasSurface) {
+        std::cerr << "Failed to create glyph atlas: " << SDL_GetError() << std::endl;
+        return;
+    }
+    atlas = SDL_CreateTextureFromSurface(renderer, atlasSurface);
+    SDL_FreeSurface(atlasSurface);
+    if (!atlas) {
+        std::cerr << "Failed to create glyph atlas texture: " << SDL_GetError() << std::endl;
+        return;
+    }
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+}
+
+void TextRenderer::setText(TextLabel& label, const std::string& text, SDL_Color color) const {
+    if (!label.vertices.empty() && label.text == text && label.color.r == color.r &&
+        label.color.g == color.g && label.color.b == color.b && label.color.a == color.a) {
+        return;
+    }
+
+    label.text = text;
+    label.color = color;
+    label.vertices.clear();
+    label.indices.clear();
+    label.width = 0;
+    label.height = text.empty() ? 0 : lineSkip;
+
+    // The atlas is white, the vertex colour tints it
+    float invWidth = atlasWidth > 0 ? 1.0f / atlasWidth : 0.0f;
+    float invHeight = atlasHeight > 0 ? 1.0f / atlasHeight : 0.0f;
+    int penX = 0, penY = 0;
+    for (char ch : text) {
+        if (ch == '\n') {
+            penX = 0;
+            penY += lineSkip;
+            label.height += lineSkip;
+            continue;
+        }
+        int c = (unsigned char)ch;
+        if (c < FIRST_GLYPH || c > LAST_GLYPH) {
+            c = '?';
+        }
+
+        const Glyph& glyph = glyphs[c - FIRST_GLYPH];
+        if (glyph.source.w > 0) {
+            float left = (float)(label.x + penX);
+            float top = (float)(label.y + penY);
+            float right = left + glyph.source.w;
+            float bottom = top + glyph.source.h;
+            float u0 = glyph.source.x * invWidth;
+            float v0 = glyph.source.y * invHeight;
+            float u1 = (glyph.source.x + glyph.source.w) * invWidth;
+            float v1 = (glyph.source.y + glyph.source.h) * invHeight;
+
+            int base = (int)label.vertices.size();
+            label.vertices.push_back({{left, top}, color, {u0, v0}});
+            label.vertices.push_back({{right, top}, color, {u1, v0}});
+            label.vertices.push_back({{right, bottom}, color, {u1, v1}});
+            label.vertices.push_back({{left, bottom}, color, {u0, v1}});
+            const int quad[6] = {0, 1, 2, 0, 2, 3};
+            for (int q : quad) {
+                label.indices.push_back(base + q);
+            }
+        }
+        penX += glyph.advance;
+        label.width = std::max(label.width, penX);
+    }
+}
+
+void TextRenderer::setPosition(TextLabel& label, int x, int y) const {
+    float dx = (float)(x - label.x);
+    float dy = (float)(y - label.y);
+    for (SDL_Vertex& vertex : label.vertices) {
+        vertex.position.x += dx;
+        vertex.position.y += dy;
+    }
+    label.x = x;
+    label.y = y;
+}
+
+void TextRenderer::draw(const TextLabel& label) const {
+    if (!atlas || label.indices.empty()) {
+        return;
+    }
+    SDL_RenderGeometry(renderer, atlas, label.vertices.data(), (int)label.vertices.size(),
+                       label.indices.data(), (int)label.indices.size());
+}
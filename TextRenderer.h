@@ -0,0 +1,61 @@
+#ifndef TEXTRENDERER_H
+#define TEXTRENDERER_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+// A string laid out as textured quads, ready to draw in one call. Labels
+// keep their geometry until the text, colour or position changes.
+struct TextLabel {
+    std::string text;
+    SDL_Color color = {255, 255, 255, 255};
+    int x = 0;
+    int y = 0;
+    int width = 0; // Size of the laid out text in pixels
+    int height = 0;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+};
+
+// Printable ASCII rasterized once into a single atlas texture. Strings are
+// drawn as batched quads from the atlas, so no surfaces or textures are
+// created per frame.
+class TextRenderer {
+public:
+    TextRenderer(SDL_Renderer* renderer, const std::string& fontFile, int pointSize);
+    ~TextRenderer();
+
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    // Lay out text with its top-left corner at the label position. Does
+    // nothing when the text and colour are unchanged.
+    void setText(TextLabel& label, const std::string& text, SDL_Color color) const;
+    // Move an already laid out label
+    void setPosition(TextLabel& label, int x, int y) const;
+    void draw(const TextLabel& label) const;
+
+    int lineHeight() const { return lineSkip; }
+
+private:
+    static const int FIRST_GLYPH = 32; // Space
+    static const int LAST_GLYPH = 126; // Tilde
+    static const int ATLAS_WIDTH = 512;
+
+    struct Glyph {
+        SDL_Rect source; // Area in the atlas, empty for blank glyphs
+        int advance;
+    };
+
+    void buildAtlas(const std::string& fontFile, int pointSize);
+
+    SDL_Renderer* renderer;
+    SDL_Texture* atlas;
+    int atlasWidth;
+    int atlasHeight;
+    int lineSkip;
+    Glyph glyphs[LAST_GLYPH - FIRST_GLYPH + 1];
+};
+
+#endif
@@ -0,0 +1,36 @@
+#include "TextureStore.h"
+#include <algorithm>
+
+static int log2Ceil(int value) {
+    int shift = 0;
+    while ((1 << shift) < value) {
+        shift++;
+    }
+    return shift;
+}
+
+int TextureStore::add(const PixelImage& image) {
+    Entry entry;
+    entry.widthShift = log2Ceil(image.width);
+    entry.heightShift = log2Ceil(image.height);
+    entry.offset = texels.size();
+
+    int width = 1 << entry.widthShift;
+    int height = 1 << entry.heightShift;
+    texels.resize(entry.offset + (size_t)width * height);
+
+    // Transpose, resampling with nearest neighbour when the source is not
+    // already a power of two
+    Uint32* dst = texels.data() + entry.offset;
+    for (int x = 0; x < width; x++) {
+        int srcX = x * image.width / width;
+        for (int y = 0; y < height; y++) {
+            int srcY = y * image.height / height;
+            *dst++ = image.pixels[srcY * image.width + srcX];
+        }
+    }
+
+    maxShift = std::max(maxShift, entry.widthShift);
+    entries.push_back(entry);
+    return (int)entries.size() - 1;
+}
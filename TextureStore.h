@@ -0,0 +1,45 @@
+#ifndef TEXTURESTORE_H
+#define TEXTURESTORE_H
+
+#include "Framebuffer.h"
+#include <vector>
+
+// Textures transposed into one column-major block, so walking a wall column
+// (fixed texX, varying texY) reads sequential memory. Sizes are rounded up
+// to powers of two: texel (x, y) of a texture lives at
+// column(texture, x)[y & (height - 1)].
+class TextureStore {
+public:
+    // Returns the index of the new texture
+    int add(const PixelImage& image);
+
+    int count() const { return (int)entries.size(); }
+    int width(int texture) const { return 1 << entries[texture].widthShift; }
+    int height(int texture) const { return 1 << entries[texture].heightShift; }
+    int widthShift(int texture) const { return entries[texture].widthShift; }
+    int heightShift(int texture) const { return entries[texture].heightShift; }
+    // Widest texture, texX computed at this width maps to any texture with
+    // texX >> (maxWidthShift() - widthShift(texture))
+    int maxWidthShift() const { return maxShift; }
+
+    // First texel of a texture, texel (x, y) is at (x << heightShift) + y
+    const Uint32* data(int texture) const { return texels.data() + entries[texture].offset; }
+
+    const Uint32* column(int texture, int x) const {
+        const Entry& entry = entries[texture];
+        return texels.data() + entry.offset + (x << entry.heightShift);
+    }
+
+private:
+    struct Entry {
+        int widthShift;  // log2(width)
+        int heightShift; // log2(height), the height is also the column stride
+        size_t offset;   // First texel in `texels`
+    };
+
+    std::vector<Entry> entries;
+    int maxShift = 0;
+    std::vector<Uint32> texels;
+};
+
+#endif
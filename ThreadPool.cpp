@@ -0,0 +1,131 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int numThreads)
+    : generation(0), stopping(false), job(nullptr), remaining(0) {
+    if (numThreads <= 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (int i = 0; i < numThreads; i++) {
+        queues.emplace_back(new WorkerQueue());
+    }
+
+    // Queue 0 belongs to the calling thread
+    for (int i = 1; i < numThreads; i++) {
+        threads.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::parallelFor(int count, int tileSize,
+                             const std::function<void(int, int)>& fn) {
+    if (count <= 0)
+        return;
+    tileSize = std::max(1, tileSize);
+
+    int numTiles = (count + tileSize - 1) / tileSize;
+    if (queues.size() == 1 || numTiles == 1) {
+        fn(0, count);
+        return;
+    }
+
+    job = &fn;
+    remaining.store(numTiles);
+
+    // Hand each worker a contiguous run of tiles so neighbouring columns
+    // stay on one core unless they get stolen
+    int numQueues = (int)queues.size();
+    for (int q = 0; q < numQueues; q++) {
+        int firstTile = numTiles * q / numQueues;
+        int lastTile = numTiles * (q + 1) / numQueues;
+
+        std::lock_guard<std::mutex> lock(queues[q]->mutex);
+        for (int t = firstTile; t < lastTile; t++) {
+            Tile tile = {t * tileSize, std::min(count, (t + 1) * tileSize)};
+            queues[q]->tiles.push_back(tile);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+    }
+    wake.notify_all();
+
+    // The caller works too, then waits for tiles still running elsewhere
+    while (runOneTile(0)) {
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return remaining.load() == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::workerLoop(int index) {
+    profilerSetThreadName("pool worker " + std::to_string(index));
+    unsigned seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping)
+                return;
+            seenGeneration = generation;
+        }
+
+        while (runOneTile(index)) {
+        }
+    }
+}
+
+// Pop from the front of our own queue, otherwise steal from the back of
+// someone else's. Returns false once there is nothing left to take.
+bool ThreadPool::runOneTile(int index) {
+    Tile tile;
+    bool found = false;
+
+    {
+        WorkerQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tiles.empty()) {
+            tile = own.tiles.front();
+            own.tiles.pop_front();
+            found = true;
+        }
+    }
+
+    int numQueues = (int)queues.size();
+    for (int i = 1; i < numQueues && !found; i++) {
+        WorkerQueue& victim = *queues[(index + i) % numQueues];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tiles.empty()) {
+            tile = victim.tiles.back();
+            victim.tiles.pop_back();
+            found = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    (*job)(tile.begin, tile.end);
+
+    if (remaining.fetch_sub(1) == 1) {
+        // Last tile of the job: wake the caller
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.notify_all();
+    }
+    return true;
+}
@@ -0,0 +1,55 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Persistent worker pool for splitting a frame into tiles. Each worker owns a
+// queue of tiles and steals from the others once its own queue runs dry, so
+// cheap and expensive tiles even out across threads.
+class ThreadPool {
+public:
+    // numThreads counts the calling thread, which also runs tiles.
+    // 0 picks one thread per hardware thread.
+    explicit ThreadPool(int numThreads);
+    ~ThreadPool();
+
+    int size() const { return (int)queues.size(); }
+
+    // Run fn(begin, end) over [0, count) in tiles of tileSize and wait for
+    // every tile to finish before returning
+    void parallelFor(int count, int tileSize, const std::function<void(int, int)>& fn);
+
+private:
+    struct Tile {
+        int begin, end;
+    };
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Tile> tiles;
+    };
+
+    void workerLoop(int index);
+    bool runOneTile(int index);
+
+    std::vector<std::thread> threads;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+    std::mutex mutex;
+    std::condition_variable wake;     // Workers wait here for a new job
+    std::condition_variable finished; // The caller waits here for the last tile
+    unsigned generation;              // Bumped once per parallelFor call
+    bool stopping;
+
+    const std::function<void(int, int)>* job;
+    std::atomic<int> remaining; // Tiles of the current job not yet finished
+};
+
+#endif
@@ -0,0 +1,30 @@
+#include "Visibility.h"
+#include "LineOfSight.h"
+#include "MapVisibility.h"
+#include <stdexcept>
+
+static_assert(sizeof(MAP_PVS) / sizeof(MAP_PVS[0]) == PVS_CELLS * PVS_ROW_WORDS,
+              "MapVisibility.h was built for a different map size");
+
+bool cellsMayBeVisible(int ax, int ay, int bx, int by) {
+    if (ax < 0 || ax >= MAP_WIDTH || ay < 0 || ay >= MAP_HEIGHT || bx < 0 || bx >= MAP_WIDTH ||
+        by < 0 || by >= MAP_HEIGHT) {
+        return true;
+    }
+    int from = ax * MAP_HEIGHT + ay;
+    int to = bx * MAP_HEIGHT + by;
+    return (MAP_PVS[from * PVS_ROW_WORDS + to / 32] >> (to % 32)) & 1;
+}
+
+bool isLineClear(double startX, double startY, double endX, double endY) {
+    if (!cellsMayBeVisible(int(startX), int(startY), int(endX), int(endY))) {
+        return false;
+    }
+    return !hasWallBetweenPoints(startX, startY, endX, endY);
+}
+
+void checkVisibilityData() {
+    if (mapChecksum() != MAP_PVS_CHECKSUM) {
+        throw std::runtime_error("MapVisibility.h is out of date, run make MapVisibility.h");
+    }
+}
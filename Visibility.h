@@ -0,0 +1,24 @@
+#ifndef VISIBILITY_H
+#define VISIBILITY_H
+
+#include "Map.h"
+
+// Potentially visible set (PVS): for every pair of cells, whether anything
+// in one could see anything in the other. It is built ahead of time by
+// mapcompile into MapVisibility.h, so most pairs that cannot see each other
+// are rejected with one bit test, however far apart, before any DDA runs.
+
+const int PVS_CELLS = MAP_WIDTH * MAP_HEIGHT;
+const int PVS_ROW_WORDS = (PVS_CELLS + 31) / 32;
+
+// Function prototypes
+// False if nothing in cell (ax, ay) can see anything in cell (bx, by).
+// Cells off the map are never ruled out.
+bool cellsMayBeVisible(int ax, int ay, int bx, int by);
+// True if no wall lies between the points. Checks the PVS first and only
+// runs hasWallBetweenPoints() for cells that may see each other.
+bool isLineClear(double startX, double startY, double endX, double endY);
+// Throws std::runtime_error if MapVisibility.h is out of date with Map.h
+void checkVisibilityData();
+
+#endif
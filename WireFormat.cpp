@@ -0,0 +1,139 @@
+#include "WireFormat.h"
+#include <cstring>
+#include <stdexcept>
+
+void WireWriter::writeU8(uint8_t value) {
+    data.push_back(value);
+}
+
+void WireWriter::writeU16(uint16_t value) {
+    uint8_t bytes[2] = {uint8_t(value), uint8_t(value >> 8)};
+    writeBytes(bytes, sizeof(bytes));
+}
+
+void WireWriter::writeU32(uint32_t value) {
+    uint8_t bytes[4];
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = uint8_t(value >> (8 * i));
+    }
+    writeBytes(bytes, sizeof(bytes));
+}
+
+void WireWriter::writeF64(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint8_t bytes[8];
+    for (int i = 0; i < 8; i++) {
+        bytes[i] = uint8_t(bits >> (8 * i));
+    }
+    writeBytes(bytes, sizeof(bytes));
+}
+
+// One resize and copy per field rather than a push_back per byte
+void WireWriter::writeBytes(const void* bytes, size_t size) {
+    size_t offset = data.size();
+    data.resize(offset + size);
+    memcpy(data.data() + offset, bytes, size);
+}
+
+void WireWriter::beginMessage(uint8_t type) {
+    if (inMessage) {
+        endMessage();
+    }
+    messageStart = data.size();
+    inMessage = true;
+    writeU8(type);
+    writeU16(0); // Length, patched by endMessage()
+}
+
+void WireWriter::endMessage() {
+    if (!inMessage) {
+        return;
+    }
+    inMessage = false;
+    size_t length = data.size() - messageStart - MESSAGE_HEADER_SIZE;
+    if (length > MAX_MESSAGE_PAYLOAD) {
+        data.resize(messageStart);
+        throw std::runtime_error("Message payload too long");
+    }
+    data[messageStart + 1] = uint8_t(length);
+    data[messageStart + 2] = uint8_t(length >> 8);
+}
+
+void WireWriter::clear() {
+    data.clear();
+    inMessage = false;
+}
+
+bool WireReader::take(size_t count) {
+    if (!valid || count > size - position) {
+        valid = false;
+        return false;
+    }
+    return true;
+}
+
+uint8_t WireReader::readU8() {
+    if (!take(1)) {
+        return 0;
+    }
+    return data[position++];
+}
+
+uint16_t WireReader::readU16() {
+    if (!take(2)) {
+        return 0;
+    }
+    uint16_t value = uint16_t(data[position] | (data[position + 1] << 8));
+    position += 2;
+    return value;
+}
+
+uint32_t WireReader::readU32() {
+    if (!take(4)) {
+        return 0;
+    }
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; i--) {
+        value = (value << 8) | data[position + i];
+    }
+    position += 4;
+    return value;
+}
+
+double WireReader::readF64() {
+    if (!take(8)) {
+        return 0.0;
+    }
+    uint64_t bits = 0;
+    for (int i = 7; i >= 0; i--) {
+        bits = (bits << 8) | data[position + i];
+    }
+    position += 8;
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+const uint8_t* WireReader::readBytes(size_t count) {
+    if (!take(count)) {
+        return nullptr;
+    }
+    const uint8_t* bytes = data + position;
+    position += count;
+    return bytes;
+}
+
+bool MessageIterator::next(uint8_t& type, WireReader& payload) {
+    if (packet.remaining() < MESSAGE_HEADER_SIZE) {
+        return false;
+    }
+    type = packet.readU8();
+    uint16_t length = packet.readU16();
+    const uint8_t* bytes = packet.readBytes(length);
+    if (!bytes) {
+        return false;
+    }
+    payload = WireReader(bytes, length);
+    return true;
+}
@@ -0,0 +1,84 @@
+#ifndef WIREFORMAT_H
+#define WIREFORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Byte-level wire format. A packet holds one or more messages back to back,
+// each a 1-byte type and a 2-byte payload length followed by the payload.
+// Every multi-byte field is little-endian and fixed-width whatever the host,
+// so nothing depends on struct padding, sizeof(size_t) or byte order.
+
+const size_t MESSAGE_HEADER_SIZE = 3;
+const size_t MAX_MESSAGE_PAYLOAD = 0xFFFF;
+
+// Appends fields to a growing packet
+class WireWriter {
+public:
+    WireWriter() : messageStart(0), inMessage(false) {}
+
+    void writeU8(uint8_t value);
+    void writeU16(uint16_t value);
+    void writeU32(uint32_t value);
+    void writeF64(double value);
+    void writeBytes(const void* bytes, size_t size);
+
+    // Messages are written between these two; endMessage() fills in the
+    // length. Throws std::runtime_error if the payload is too long.
+    void beginMessage(uint8_t type);
+    void endMessage();
+
+    const std::vector<uint8_t>& bytes() const { return data; }
+    // For encoders that append to the packet themselves, like BitWriter
+    std::vector<uint8_t>& buffer() { return data; }
+    bool empty() const { return data.empty(); }
+    void clear();
+
+private:
+    std::vector<uint8_t> data;
+    size_t messageStart; // Offset of the open message's header
+    bool inMessage;
+};
+
+// Reads fields in place from a buffer it does not own. Reading past the end
+// returns zeros and clears ok(), so a message can be read in full and
+// checked once.
+class WireReader {
+public:
+    WireReader() : data(nullptr), size(0), position(0), valid(true) {}
+    WireReader(const uint8_t* data, size_t size) : data(data), size(size), position(0), valid(true) {}
+
+    uint8_t readU8();
+    uint16_t readU16();
+    uint32_t readU32();
+    double readF64();
+    // Pointer into the buffer, not a copy; nullptr if fewer bytes remain
+    const uint8_t* readBytes(size_t count);
+
+    bool ok() const { return valid; }
+    size_t remaining() const { return size - position; }
+
+private:
+    bool take(size_t count);
+
+    const uint8_t* data;
+    size_t size;
+    size_t position;
+    bool valid;
+};
+
+// Walks the messages in a packet without copying them
+class MessageIterator {
+public:
+    MessageIterator(const uint8_t* data, size_t size) : packet(data, size) {}
+
+    // The next message's type and a reader over just its payload. Returns
+    // false at the end of the packet or if the rest of it is malformed.
+    bool next(uint8_t& type, WireReader& payload);
+
+private:
+    WireReader packet;
+};
+
+#endif
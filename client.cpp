@@ -1,7 +1,19 @@
+#include "ClientNetwork.h"
+#include "Framebuffer.h"
 #include "GameState.h"
 #include "Lobby.h"
 #include "Menu.h"
+#include "Movement.h"
+#include "Profiler.h"
+#include "ProfilerOverlay.h"
+#include "Protocol.h"
+#include "Raycaster.h"
+#include "ResolutionScaler.h"
+#include "SnapshotCodec.h"
+#include "SnapshotHistory.h"
 #include "SpriteSheet.h"
+#include "TextRenderer.h"
+#include "ThreadPool.h"
 #include "common.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
@@ -10,20 +22,32 @@
 #include <SDL2/SDL_timer.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
 #include <enet/enet.h>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 const char *SERVER_HOST = "127.0.0.1";
 // const char* SERVER_HOST = "192.168.163.247";
 const int SERVER_PORT = 1234;
 
+// Settings that can be changed from the command line
+struct ClientConfig {
+  int renderThreads = 0; // Threads for the wall pass, 0 = one per core
+  double frameBudgetMs = 8.3; // Render time target, 0 = fixed full resolution
+  double interpolationDelayMs = 100.0; // How far behind remote players are drawn
+  bool vsync = true;
+  int maxFps = 0; // Frame rate cap on top of vsync, 0 = none
+};
+
 class GameClient {
 private:
   SDL_Window *window;
   SDL_Renderer *renderer;
-  ENetHost *client;
-  ENetPeer *server;
+  ClientNetwork network; // ENet runs on its own thread once connected
   std::vector<PlayerState> players;
   size_t playerID;
   bool isRunning;
@@ -38,16 +62,72 @@ private:
   Uint32 lastShotTime = 0;
   const int SHOOT_ANIMATION_MS = 500; // Animation duration in milliseconds
 
-  static const int NUM_TEXTURES = 4;
-  SDL_Texture *wallTextures[NUM_TEXTURES];
-  static const int TEX_WIDTH = 64;
-  static const int TEX_HEIGHT = 64;
   // SDL_Texture* playerTexture;
   SpriteSheet playerSprite;
   SpriteSheet weaponSprite;
 
-  void handleInput() {
-    const Uint8 *state = SDL_GetKeyboardState(NULL);
+  // Minimap placement, the wall layer is cached in a target texture
+  static const int MINIMAP_SIZE = 150; // Size of the minimap in pixels
+  static const int MINIMAP_X = SCREEN_WIDTH - MINIMAP_SIZE - 10; // From right
+  static const int MINIMAP_Y = 10;                               // From top
+  static const int MINIMAP_CELL_SIZE = MINIMAP_SIZE / MAP_WIDTH;
+  SDL_Texture *minimapLayer = nullptr;
+  bool minimapDirty = true; // Set when the map or render targets change
+
+  // Wall textures reused for the floor and ceiling (wall type - 1)
+  static const int FLOOR_TEXTURE = 2;
+  static const int CEILING_TEXTURE = 0;
+
+  // Remote players are drawn interpolationDelay seconds in the past, between
+  // the two snapshots around that time
+  double interpolationDelay;
+  std::vector<SnapshotHistory> playerHistory; // Per player, newest last
+  std::vector<PlayerState> renderStates;      // Where this frame draws everyone
+  // The server leaves out players we cannot see; they are not drawn
+  std::vector<bool> playerVisible;
+
+  // Our own player is predicted: movement is sampled once per server tick,
+  // applied locally straight away and kept until the server says it has
+  // applied it too. Between ticks we are drawn part way from the previous
+  // prediction to the current one.
+  static const size_t MAX_PENDING_INPUTS = 256;
+  const double MAX_INPUT_CATCH_UP = 0.25; // Seconds of input after a stall
+  double tickDt = 1.0 / DEFAULT_TICK_RATE; // Until the server says otherwise
+  std::deque<InputPacket> pendingInputs; // Sent but not yet acknowledged
+  uint32_t nextInputSequence = 1;
+  uint32_t clientTick = 0; // Ticks of input sampled so far
+  double lastInputTime = 0.0;
+  double inputAccumulator = 0.0; // Time not yet covered by an input
+  double mouseRotation = 0.0;    // Mouse movement since the last input
+  PlayerState previousPrediction;
+  bool hasPreviousPrediction = false;
+
+  // Recent snapshots, the baselines the server encodes new ones against
+  SnapshotRing receivedSnapshots;
+  uint32_t latestSnapshotTick = 0; // Acknowledged with every input
+  bool vsync;
+  int maxFps;
+
+  // Software rendering: walls and sprites are drawn on the CPU and uploaded
+  // once per frame
+  Framebuffer framebuffer;
+  Raycaster raycaster;
+  ThreadPool renderPool;
+  ResolutionScaler resolutionScaler;
+
+  // Menu and lobby screens share one glyph atlas
+  std::unique_ptr<TextRenderer> text;
+  std::unique_ptr<Menu> menu;
+  std::unique_ptr<Lobby> lobby;
+  std::unique_ptr<ProfilerOverlay> profilerOverlay; // F3 shows, F4 saves a trace
+
+  void sendPacket(enet_uint8 channel, const WireWriter &out,
+                  enet_uint32 flags) {
+    network.send(out.bytes().data(), out.bytes().size(), channel, flags);
+  }
+
+  // Build, predict and send one tick of movement input
+  void sendMovementInput(const Uint8 *state) {
     InputPacket input = {}; // Initialize all fields to zero/false
 
     // Basic movement
@@ -57,6 +137,40 @@ private:
     input.strafeRight = state[SDL_SCANCODE_D];
     input.turnLeft = state[SDL_SCANCODE_LEFT];
     input.turnRight = state[SDL_SCANCODE_RIGHT];
+    // The server rejects larger turns, so a huge mouse flick is clamped
+    input.mouseRotation = std::max(-MAX_MOUSE_ROTATION,
+                                   std::min(MAX_MOUSE_ROTATION, mouseRotation));
+    mouseRotation = 0.0;
+    input.sequence = nextInputSequence++;
+    input.clientTick = clientTick++;
+
+    // Move straight away instead of waiting a round trip for the server
+    if (playerID < players.size()) {
+      previousPrediction = players[playerID];
+      hasPreviousPrediction = true;
+      applyInput(players, playerID, input, tickDt);
+    }
+    pendingInputs.push_back(input);
+    if (pendingInputs.size() > MAX_PENDING_INPUTS) {
+      pendingInputs.pop_front();
+    }
+
+    // Send the newest few unacknowledged inputs. If all copies of one are
+    // lost the next snapshot shows where we really are and reconcile()
+    // corrects us.
+    InputBatchPacket batch = {};
+    batch.ackTick = latestSnapshotTick;
+    batch.count = std::min(pendingInputs.size(), INPUT_REDUNDANCY);
+    std::copy(pendingInputs.end() - batch.count, pendingInputs.end(),
+              batch.inputs);
+    WireWriter out;
+    writeInputBatch(out, batch);
+    sendPacket(MOVEMENT_CHANNEL, out, 0);
+  }
+
+  void handleInput() {
+    PROFILE_SCOPE("input");
+    const Uint8 *state = SDL_GetKeyboardState(NULL);
 
     // Mouse grab toggle
     int mouseX, mouseY;
@@ -87,15 +201,19 @@ private:
     if (mouseGrabbed) {
       int xrel, yrel;
       SDL_GetRelativeMouseState(&xrel, &yrel);
-      input.mouseRotation = xrel * MOUSE_SENSITIVITY;
-    } else {
-      input.mouseRotation = 0.0;
+      mouseRotation += xrel * MOUSE_SENSITIVITY;
     }
 
-    // Send movement/rotation input to server
-    ENetPacket *packet = enet_packet_create(&input, sizeof(InputPacket),
-                                            ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(server, 0, packet);
+    // One input per server tick, however fast we render
+    double now = clockSeconds();
+    if (lastInputTime > 0.0) {
+      inputAccumulator += std::min(MAX_INPUT_CATCH_UP, now - lastInputTime);
+    }
+    lastInputTime = now;
+    while (inputAccumulator >= tickDt) {
+      inputAccumulator -= tickDt;
+      sendMovementInput(state);
+    }
 
     // Handle shooting as a completely separate system
     static bool spaceWasPressed = false;
@@ -114,9 +232,9 @@ private:
       shotPacket.shooterDirX = players[playerID].dirX;
       shotPacket.shooterDirY = players[playerID].dirY;
 
-      packet = enet_packet_create(&shotPacket, sizeof(ShotAttemptPacket),
-                                  ENET_PACKET_FLAG_RELIABLE);
-      enet_peer_send(server, 0, packet);
+      WireWriter out;
+      writeShotAttempt(out, shotPacket);
+      sendPacket(RELIABLE_CHANNEL, out, ENET_PACKET_FLAG_RELIABLE);
     }
     spaceWasPressed = spaceIsPressed;
 
@@ -131,24 +249,16 @@ private:
       currentWeapon = 3;
   }
 
-  void renderMinimap() {
-    const int MINIMAP_SIZE = 150; // Size of the minimap in pixels
-    const int MINIMAP_X =
-        SCREEN_WIDTH - MINIMAP_SIZE - 10;           // Position from right
-    const int MINIMAP_Y = 10;                       // Position from top
-    const int CELL_SIZE = MINIMAP_SIZE / MAP_WIDTH; // Size of each map cell
-    const int PLAYER_DOT_SIZE = 4;       // Size of player dots on minimap
-    const int DIRECTION_LINE_LENGTH = 8; // Length of direction indicator
-
+  // Draw the static wall layer with its top-left corner at (originX, originY)
+  void drawMinimapWalls(int originX, int originY) {
     // Draw minimap background
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 192); // Semi-transparent black
-    SDL_Rect minimapBG = {MINIMAP_X, MINIMAP_Y, MINIMAP_SIZE, MINIMAP_SIZE};
+    SDL_Rect minimapBG = {originX, originY, MINIMAP_SIZE, MINIMAP_SIZE};
     SDL_RenderFillRect(renderer, &minimapBG);
 
-    // Draw walls
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-      for (int x = 0; x < MAP_WIDTH; x++) {
+    // Draw walls, walking worldMap[x][y] in memory order
+    for (int x = 0; x < MAP_WIDTH; x++) {
+      for (int y = 0; y < MAP_HEIGHT; y++) {
         if (worldMap[x][y] > 0) {
           // Choose color based on wall type
           switch (worldMap[x][y]) {
@@ -168,314 +278,197 @@ private:
             SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White
           }
 
-          SDL_Rect wallRect = {MINIMAP_X + (x * CELL_SIZE),
-                               MINIMAP_Y + (y * CELL_SIZE), CELL_SIZE,
-                               CELL_SIZE};
+          SDL_Rect wallRect = {originX + (x * MINIMAP_CELL_SIZE),
+                               originY + (y * MINIMAP_CELL_SIZE),
+                               MINIMAP_CELL_SIZE, MINIMAP_CELL_SIZE};
           SDL_RenderFillRect(renderer, &wallRect);
         }
       }
     }
 
-    // Draw players
-    for (size_t i = 0; i < players.size(); i++) {
-      const PlayerState &player = players[i];
-
-      // Calculate player position on minimap
-      int playerMinimapX =
-          MINIMAP_X + static_cast<int>(player.posX * CELL_SIZE);
-      int playerMinimapY =
-          MINIMAP_Y + static_cast<int>(player.posY * CELL_SIZE);
-
-      // Draw player dot
-      if (i == playerID) {
-        // Current player in yellow
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
-      } else {
-        // Other players in red
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-      }
-
-      SDL_Rect playerRect = {playerMinimapX - PLAYER_DOT_SIZE / 2,
-                             playerMinimapY - PLAYER_DOT_SIZE / 2,
-                             PLAYER_DOT_SIZE, PLAYER_DOT_SIZE};
-      SDL_RenderFillRect(renderer, &playerRect);
-
-      // Draw direction indicator for current player
-      if (i == playerID) {
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
-        SDL_RenderDrawLine(
-            renderer, playerMinimapX, playerMinimapY,
-            playerMinimapX +
-                static_cast<int>(player.dirX * DIRECTION_LINE_LENGTH),
-            playerMinimapY +
-                static_cast<int>(player.dirY * DIRECTION_LINE_LENGTH));
-      }
-    }
-
     // Draw minimap border
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
     SDL_RenderDrawRect(renderer, &minimapBG);
   }
-  void render() {
-    if (players.empty() || playerID >= players.size()) {
-      std::cerr << "Error: No valid player data. Skipping rendering."
-                << std::endl;
-      return;
+
+  // Render the wall layer into its cached texture. Only needed when the map
+  // changes or the renderer loses its target textures.
+  void rebuildMinimapLayer() {
+    if (!minimapLayer) {
+      minimapLayer =
+          SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                            SDL_TEXTUREACCESS_TARGET, MINIMAP_SIZE, MINIMAP_SIZE);
+      if (!minimapLayer) {
+        std::cerr << "Failed to create minimap layer, drawing it every frame: "
+                  << SDL_GetError() << std::endl;
+        return;
+      }
+      SDL_SetTextureBlendMode(minimapLayer, SDL_BLENDMODE_BLEND);
     }
 
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_SetRenderTarget(renderer, minimapLayer);
+    // Write the translucent background as-is instead of blending it
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
+    drawMinimapWalls(0, 0);
+    SDL_SetRenderTarget(renderer, NULL);
 
-    // Render from current player's perspective
-    const PlayerState &currentPlayer = players[playerID];
-
-    std::vector<double> zBuffer(SCREEN_WIDTH, 1e30); // Large initial depth
-
-    for (int x = 0; x < SCREEN_WIDTH; x++) {
-      double cameraX = 2 * x / double(SCREEN_WIDTH) - 1;
-      double rayDirX = currentPlayer.dirX + currentPlayer.planeX * cameraX;
-      double rayDirY = currentPlayer.dirY + currentPlayer.planeY * cameraX;
+    minimapDirty = false;
+  }
 
-      int mapX = int(currentPlayer.posX);
-      int mapY = int(currentPlayer.posY);
+  void renderMinimap() {
+    PROFILE_SCOPE("minimap");
+    const int PLAYER_DOT_SIZE = 4;       // Size of player dots on minimap
+    const int DIRECTION_LINE_LENGTH = 8; // Length of direction indicator
 
-      // Calculate ray step and initial sideDist
-      double deltaDistX = std::abs(1 / rayDirX);
-      double deltaDistY = std::abs(1 / rayDirY);
+    if (minimapDirty) {
+      rebuildMinimapLayer();
+    }
 
-      double sideDistX, sideDistY;
-      int stepX, stepY;
-      int hit = 0;
-      int side;
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    if (minimapLayer) {
+      SDL_Rect layerRect = {MINIMAP_X, MINIMAP_Y, MINIMAP_SIZE, MINIMAP_SIZE};
+      SDL_RenderCopy(renderer, minimapLayer, NULL, &layerRect);
+    } else {
+      drawMinimapWalls(MINIMAP_X, MINIMAP_Y);
+    }
 
-      // Calculate step and initial sideDist
-      if (rayDirX < 0) {
-        stepX = -1;
-        sideDistX = (currentPlayer.posX - mapX) * deltaDistX;
-      } else {
-        stepX = 1;
-        sideDistX = (mapX + 1.0 - currentPlayer.posX) * deltaDistX;
+    // Player dots and the direction line go out as one geometry batch with
+    // per-vertex colors
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    auto addQuad = [&](float x0, float y0, float x1, float y1, float x2,
+                       float y2, float x3, float y3, SDL_Color color) {
+      int base = (int)vertices.size();
+      const float corners[4][2] = {{x0, y0}, {x1, y1}, {x2, y2}, {x3, y3}};
+      for (int c = 0; c < 4; c++) {
+        SDL_Vertex vertex = {{corners[c][0], corners[c][1]}, color, {0, 0}};
+        vertices.push_back(vertex);
       }
-      if (rayDirY < 0) {
-        stepY = -1;
-        sideDistY = (currentPlayer.posY - mapY) * deltaDistY;
-      } else {
-        stepY = 1;
-        sideDistY = (mapY + 1.0 - currentPlayer.posY) * deltaDistY;
+      const int quad[6] = {0, 1, 2, 0, 2, 3};
+      for (int q = 0; q < 6; q++) {
+        indices.push_back(base + quad[q]);
       }
+    };
 
-      // DDA algorithm
-      while (hit == 0) {
-        if (sideDistX < sideDistY) {
-          sideDistX += deltaDistX;
-          mapX += stepX;
-          side = 0;
-        } else {
-          sideDistY += deltaDistY;
-          mapY += stepY;
-          side = 1;
-        }
-        if (worldMap[mapX][mapY] > 0)
-          hit = 1;
-      }
+    const SDL_Color self = {255, 255, 0, 255}; // Current player in yellow
+    const SDL_Color other = {255, 0, 0, 255};  // Other players in red
 
-      // Calculate distance to wall
-      double perpWallDist;
-      if (side == 0)
-        perpWallDist =
-            (mapX - currentPlayer.posX + (1.0 - stepX) / 2.0) / rayDirX;
-      else
-        perpWallDist =
-            (mapY - currentPlayer.posY + (1.0 - stepY) / 2.0) / rayDirY;
-
-      // Store in zBuffer for sprite rendering
-      zBuffer[x] = perpWallDist;
-
-      // Calculate wall height and drawing boundaries
-      int lineHeight = (int)(SCREEN_HEIGHT / perpWallDist);
-      int drawStart = -lineHeight / 2 + SCREEN_HEIGHT / 2;
-      if (drawStart < 0)
-        drawStart = 0;
-      int drawEnd = lineHeight / 2 + SCREEN_HEIGHT / 2;
-      if (drawEnd >= SCREEN_HEIGHT)
-        drawEnd = SCREEN_HEIGHT - 1;
-      // Calculate texture coordinates
-      double wallX;
-      if (side == 0) {
-        wallX = currentPlayer.posY + perpWallDist * rayDirY;
-      } else {
-        wallX = currentPlayer.posX + perpWallDist * rayDirX;
-      }
-      wallX -= floor(wallX);
-
-      // x coordinate on the texture
-      int texX = int(wallX * TEX_WIDTH);
-      if (side == 0 && rayDirX > 0)
-        texX = TEX_WIDTH - texX - 1;
-      if (side == 1 && rayDirY < 0)
-        texX = TEX_WIDTH - texX - 1;
-
-      // Choose texture based on wall type (1-4)
-      int texNum = worldMap[mapX][mapY] - 1;
-      // Manual clamp implementation
-      texNum = (texNum < 0)
-                   ? 0
-                   : ((texNum > NUM_TEXTURES - 1) ? NUM_TEXTURES - 1 : texNum);
-
-      // Calculate texture scaling
-      double step = 1.0 * TEX_HEIGHT / lineHeight;
-      double texPos = (drawStart - SCREEN_HEIGHT / 2 + lineHeight / 2) * step;
-
-      // Draw the textured vertical line pixel by pixel
-      for (int y = drawStart; y < drawEnd; y++) {
-        int texY = (int)texPos & (TEX_HEIGHT - 1);
-        texPos += step;
-
-        SDL_Rect srcRect = {texX, texY, 1, 1};
-        SDL_Rect destRect = {x, y, 1, 1};
-        SDL_RenderCopy(renderer, wallTextures[texNum], &srcRect, &destRect);
-      }
-    }
+    for (size_t i = 0; i < renderStates.size(); i++) {
+      if (i != playerID && !playerVisible[i])
+        continue;
+      const PlayerState &player = renderStates[i];
 
-    // Sort sprites by distance (furthest first)
-    std::vector<Sprite> spriteList;
-    for (size_t i = 0; i < players.size(); i++) {
-      if (i != playerID) {
-        double dx = players[i].posX - currentPlayer.posX;
-        double dy = players[i].posY - currentPlayer.posY;
-        double distance =
-            dx * dx + dy * dy; // Use squared distance for efficiency
+      // Calculate player position on minimap
+      float playerMinimapX = MINIMAP_X + static_cast<int>(player.posX * MINIMAP_CELL_SIZE);
+      float playerMinimapY = MINIMAP_Y + static_cast<int>(player.posY * MINIMAP_CELL_SIZE);
+      SDL_Color color = i == playerID ? self : other;
+
+      float left = playerMinimapX - PLAYER_DOT_SIZE / 2;
+      float top = playerMinimapY - PLAYER_DOT_SIZE / 2;
+      addQuad(left, top, left + PLAYER_DOT_SIZE, top, left + PLAYER_DOT_SIZE,
+              top + PLAYER_DOT_SIZE, left, top + PLAYER_DOT_SIZE, color);
 
-        spriteList.push_back(Sprite(players[i].posX, players[i].posY, distance,
-                                    &playerSprite, i));
-        // spriteList.push_back(Sprite(players[i].posX, players[i].posY,
-        // distance, &playerSprite)); spriteList.push_back({players[i].posX,
-        // players[i].posY, distance, playerSprite});
+      // Direction indicator for current player, as a one pixel wide quad
+      if (i == playerID) {
+        float endX = playerMinimapX + player.dirX * DIRECTION_LINE_LENGTH;
+        float endY = playerMinimapY + player.dirY * DIRECTION_LINE_LENGTH;
+        float normalX = -player.dirY * 0.5f;
+        float normalY = player.dirX * 0.5f;
+        addQuad(playerMinimapX + normalX, playerMinimapY + normalY,
+                endX + normalX, endY + normalY, endX - normalX, endY - normalY,
+                playerMinimapX - normalX, playerMinimapY - normalY, color);
       }
     }
 
-    std::sort(spriteList.begin(), spriteList.end(),
-              [](const Sprite &a, const Sprite &b) {
-                return a.distance > b.distance; // Render closest last
-              });
-
-    SDL_Rect srcRect, destRect; // ✅ Declare rects before using them
-
-    // Render sprites with per-pixel visibility check
-    for (const auto &sprite : spriteList) {
-      double spriteX = sprite.x - currentPlayer.posX;
-      double spriteY = sprite.y - currentPlayer.posY;
+    if (!vertices.empty()) {
+      SDL_RenderGeometry(renderer, NULL, vertices.data(), (int)vertices.size(),
+                         indices.data(), (int)indices.size());
+    }
+  }
 
-      double invDet = 1.0 / (currentPlayer.planeX * currentPlayer.dirY -
-                             currentPlayer.dirX * currentPlayer.planeY);
-      double transformX = invDet * (currentPlayer.dirY * spriteX -
-                                    currentPlayer.dirX * spriteY);
-      double transformY = invDet * (-currentPlayer.planeY * spriteX +
-                                    currentPlayer.planeX * spriteY);
+  static double clockSeconds() {
+    return SDL_GetPerformanceCounter() /
+           (double)SDL_GetPerformanceFrequency();
+  }
 
-      if (transformY <= 0)
-        continue; // Don't draw if behind the player
+  // Remote players at their interpolated state, ourselves between the last
+  // two predicted ticks
+  void updateRenderStates() {
+    renderStates = players;
+    if (hasPreviousPrediction && playerID < renderStates.size()) {
+      renderStates[playerID] =
+          interpolateState(previousPrediction, players[playerID],
+                           std::min(1.0, inputAccumulator / tickDt));
+    }
+    double renderTime = clockSeconds() - interpolationDelay;
+    for (size_t i = 0; i < renderStates.size() && i < playerHistory.size();
+         i++) {
+      if (i != playerID) {
+        playerHistory[i].sample(renderTime, renderStates[i]);
+      }
+    }
+  }
 
-      int spriteScreenX =
-          int((SCREEN_WIDTH / 2) * (1 + transformX / transformY));
+  void render() {
+    if (players.empty() || playerID >= players.size()) {
+      std::cerr << "Error: No valid player data. Skipping rendering."
+                << std::endl;
+      return;
+    }
 
-      int spriteHeight =
-          abs(int(SCREEN_HEIGHT / transformY)); // Scale with distance
-      int spriteWidth = spriteHeight;           // Maintain square proportions
+    updateRenderStates();
 
-      int drawStartY = -spriteHeight / 2 + SCREEN_HEIGHT / 2;
-      int drawEndY = spriteHeight / 2 + SCREEN_HEIGHT / 2;
-      drawStartY = std::max(0, drawStartY);
-      drawEndY = std::min(SCREEN_HEIGHT - 1, drawEndY);
+    Uint64 renderStart = SDL_GetPerformanceCounter();
 
-      int drawStartX = -spriteWidth / 2 + spriteScreenX;
-      int drawEndX = spriteWidth / 2 + spriteScreenX;
-      drawStartX = std::max(0, drawStartX);
-      drawEndX = std::min(SCREEN_WIDTH - 1, drawEndX);
+    // Render from current player's perspective
+    const PlayerState &currentPlayer = renderStates[playerID];
 
-      // for (const auto& sprite : spriteList) {
-      int playerIndex = sprite.playerIndex;
+    raycaster.drawWalls(currentPlayer, framebuffer);
 
-      // Get the other player's direction
-      double otherDirX = players[playerIndex].dirX;
-      double otherDirY = players[playerIndex].dirY;
+    // Other players as sprites, the raycaster sorts and clips them
+    std::vector<Sprite> spriteList;
+    for (size_t i = 0; i < renderStates.size(); i++) {
+      if (i != playerID && playerVisible[i]) {
+        const PlayerState &other = renderStates[i];
+        double dx = other.posX - currentPlayer.posX;
+        double dy = other.posY - currentPlayer.posY;
+        double distance =
+            dx * dx + dy * dy; // Use squared distance for efficiency
 
-      // Get current player's right direction
-      double cameraRightX = currentPlayer.planeX;
-      double cameraRightY = currentPlayer.planeY;
+        Sprite sprite(other.posX, other.posY, distance, &playerSprite, i);
 
-      // Compute dot product to determine flipping
-      double dotProduct =
-          (otherDirX * cameraRightX) + (otherDirY * cameraRightY);
-      bool shouldFlip =
-          dotProduct > 0; // ✅ Flip if looking left relative to us
+        // Get the correct walking frame
+        sprite.frame = getWalkingFrame(playerSprite, other.isMoving);
 
-      // ✅ Get the correct walking frame
-      SDL_Rect srcRect =
-          getWalkingFrame(*sprite.spriteSheet, players[playerIndex].isMoving);
+        // Flip if the other player is looking left relative to us
+        double dotProduct = (other.dirX * currentPlayer.planeX) +
+                            (other.dirY * currentPlayer.planeY);
+        sprite.flip = dotProduct > 0;
 
-      // ✅ Ensure valid dimensions
-      if (srcRect.w == 0 || srcRect.h == 0) {
-        std::cerr << "Warning: srcRect has invalid dimensions!" << std::endl;
-        continue;
-      }
-
-      // ✅ Ensure `SDL_RenderCopyEx` is actually being used
-      SDL_RendererFlip flipType =
-          shouldFlip ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
-
-      // std::cout << "Rendering Player " << playerIndex << " Flip: " <<
-      // (shouldFlip ? "YES" : "NO") << std::endl;
-
-      // ✅ Apply the flipping transformation
-      SDL_RenderCopyEx(renderer, sprite.spriteSheet->texture, &srcRect,
-                       &destRect, 0, NULL, flipType);
-      // }
-      for (int stripe = drawStartX; stripe < drawEndX; stripe++) {
-        if (stripe < 0 || stripe >= SCREEN_WIDTH)
-          continue; // Skip out-of-bounds pixels
-
-        if (transformY > zBuffer[stripe])
-          continue; // ✅ Skip if behind a wall
-
-        // ✅ Reverse texture column selection when flipping
-        int texX;
-        if (shouldFlip) {
-          texX = srcRect.x + srcRect.w -
-                 (int)((stripe - drawStartX) * (float)srcRect.w /
-                       (drawEndX - drawStartX)) -
-                 1;
-        } else {
-          texX = srcRect.x + (int)((stripe - drawStartX) * (float)srcRect.w /
-                                   (drawEndX - drawStartX));
-        }
-
-        SDL_Rect srcColumn = {texX, srcRect.y, 1,
-                              srcRect.h}; // Select 1px slice of sprite
-        SDL_Rect columnRect = {stripe, drawStartY, 1,
-                               spriteHeight}; // Render 1px wide column
-
-        SDL_RenderCopy(renderer, sprite.spriteSheet->texture, &srcColumn,
-                       &columnRect);
+        spriteList.push_back(sprite);
       }
+    }
 
-      // for (int stripe = drawStartX; stripe < drawEndX; stripe++) {
-      //     if (transformY > zBuffer[stripe]) continue; // Only remove parts
-      //     behind walls
+    raycaster.drawSprites(currentPlayer, spriteList, framebuffer);
 
-      //     // int frameIndex = (SDL_GetTicks() / 100) % (playerSprite.cols *
-      //     playerSprite.rows);
-      //     // SDL_Rect srcRect = getFrameRect(playerSprite, frameIndex);
-      //     SDL_Rect destRect = {drawStartX, drawStartY, spriteWidth,
-      //     spriteHeight};
+    // One texture upload and one copy for the whole 3D view
+    {
+      PROFILE_SCOPE("upload");
+      presentFramebuffer(renderer, framebuffer);
+    }
 
-      //     // SDL_RenderCopy(renderer, playerSprite.texture, &srcRect,
-      //     &destRect); int frameIndex = (SDL_GetTicks() / 100) %
-      //     (sprite.spriteSheet->cols * sprite.spriteSheet->rows); SDL_Rect
-      //     srcRect = getFrameRect(*sprite.spriteSheet, frameIndex);
-      //     SDL_RenderCopy(renderer, sprite.spriteSheet->texture, &srcRect,
-      //     &destRect);
+    // Adjust the internal resolution for the next frame from how long this
+    // one took
+    double renderMs = (SDL_GetPerformanceCounter() - renderStart) * 1000.0 /
+                      SDL_GetPerformanceFrequency();
+    if (resolutionScaler.update(renderMs)) {
+      resizeFramebuffer(framebuffer, resolutionScaler.width(),
+                        resolutionScaler.height());
+      raycaster.setResolution(framebuffer.width, framebuffer.height);
     }
+
     // Render weapon
     int weaponFrame = 0;
     if (isShooting) {
@@ -515,14 +508,16 @@ private:
                    &weaponDestRect);
 
     renderMinimap();
-
-    SDL_RenderPresent(renderer);
   }
 
 public:
-  Lobby lobby;
-
-  GameClient() : isRunning(false), lobby(nullptr) {
+  GameClient(const ClientConfig &config)
+      : isRunning(false),
+        interpolationDelay(config.interpolationDelayMs / 1000.0),
+        vsync(config.vsync), maxFps(config.maxFps),
+        raycaster(SCREEN_WIDTH, SCREEN_HEIGHT),
+        renderPool(config.renderThreads),
+        resolutionScaler(SCREEN_WIDTH, SCREEN_HEIGHT, config.frameBudgetMs) {
     if (SDL_Init(SDL_INIT_VIDEO) < 0 || enet_initialize() != 0) {
       throw std::runtime_error("Failed to initialize SDL or ENet");
     }
@@ -543,33 +538,35 @@ public:
     }
     std::cout << "SDL window created successfully!" << std::endl;
 
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    // With vsync the frame rate follows the display instead of a fixed delay
+    Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+    if (vsync) {
+      rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    renderer = SDL_CreateRenderer(window, -1, rendererFlags);
     if (!renderer) {
       throw std::runtime_error("Failed to create renderer: " +
                                std::string(SDL_GetError()));
     }
     std::cout << "SDL renderer created successfully!" << std::endl;
 
-    // Initialize ENet client
-    client = enet_host_create(NULL, 1, 2, 0, 0);
-    if (!client) {
-      throw std::runtime_error("Failed to create ENet client host");
-    }
-    std::cout << "ENet client created successfully!" << std::endl;
+    framebuffer = createFramebuffer(renderer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    raycaster.setThreadPool(&renderPool);
+    std::cout << "Rendering with " << renderPool.size() << " thread(s)"
+              << std::endl;
 
     // Initialize other pointers to nullptr
-    server = nullptr;
     playerTexture = nullptr;
-    for (int i = 0; i < NUM_TEXTURES; i++) {
-      wallTextures[i] = nullptr;
-    }
 
     // Initialize game state
     gameState = MENU;
     isRunning = true;
 
-    // Initialize lobby
-    lobby = Lobby(renderer);
+    // Initialize menu and lobby
+    text.reset(new TextRenderer(renderer, "arial.ttf", 24));
+    menu.reset(new Menu(renderer, *text));
+    lobby.reset(new Lobby(renderer, *text));
+    profilerOverlay.reset(new ProfilerOverlay(*text));
 
     std::cout << "GameClient initialization complete!" << std::endl;
   }
@@ -577,16 +574,15 @@ public:
   // void updateLobby(std::vector<PlayerState> players);
 
   void run() {
-    Menu menu(renderer);
-    Lobby lobby(renderer);
-
-    const int FPS = 60;
-    const int FRAME_DELAY = 1000 / FPS;
+    // Remote players are interpolated, so nothing ties the frame rate to
+    // the network; only cap it when asked
+    const Uint32 FRAME_DELAY = maxFps > 0 ? 1000 / maxFps : 0;
     Uint32 frameStart;
-    int frameTime;
+    Uint32 frameTime;
 
     // Make sure gameState is initialized to MENU
     gameState = MENU;
+    profilerSetThreadName("main");
 
     while (isRunning) {
       frameStart = SDL_GetTicks();
@@ -600,6 +596,19 @@ public:
           break;
         }
 
+        // Target textures lose their contents on a device or target reset
+        if (e.type == SDL_RENDER_TARGETS_RESET ||
+            e.type == SDL_RENDER_DEVICE_RESET) {
+          minimapDirty = true;
+        }
+
+        // Profiler controls work in every state
+        if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+          profilerOverlay->toggle();
+        } else if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F4) {
+          saveTrace();
+        }
+
         // Handle other events based on game state
         switch (gameState) {
         case MENU:
@@ -644,16 +653,19 @@ public:
           break;
 
         case PLAYING:
-          handleInput();
           break;
         }
       }
 
-      // Process network events regardless of game state
-      if (client != nullptr) {
-        processNetworkEvents();
+      // Read the controls every frame; handleInput sends one input per elapsed
+      // server tick from inputAccumulator, not one per frame
+      if (gameState == PLAYING) {
+        handleInput();
       }
 
+      // Process network events regardless of game state
+      processNetworkEvents();
+
       // Clear the screen before rendering
       SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
       SDL_RenderClear(renderer);
@@ -661,64 +673,60 @@ public:
       // Render based on current game state
       switch (gameState) {
       case MENU:
-        menu.render();
+        menu->render();
         break;
       case LOBBY:
-        lobby.render();
+        lobby->render();
         break;
       case PLAYING:
         render();
         break;
       }
 
+      profilerOverlay->update();
+      profilerOverlay->render(renderer);
+
       // Update display
-      SDL_RenderPresent(renderer);
+      {
+        PROFILE_SCOPE("present");
+        SDL_RenderPresent(renderer);
+      }
 
       // Frame timing
       frameTime = SDL_GetTicks() - frameStart;
       if (FRAME_DELAY > frameTime) {
+        PROFILE_SCOPE("sleep");
         SDL_Delay(FRAME_DELAY - frameTime);
       }
     }
   }
 
+  // Dump the profiler's ring buffers for chrome://tracing or Perfetto
+  void saveTrace() {
+    std::string file = "trace-" + std::to_string(SDL_GetTicks()) + ".json";
+    if (profilerWriteTrace(file)) {
+      std::cout << "Saved profiler trace to " << file << std::endl;
+    } else {
+      std::cerr << "Failed to write profiler trace " << file << std::endl;
+    }
+  }
+
   void sendJoinRequest() {
-    if (!server)
+    if (!network.isConnected())
       return;
 
     std::cout << "sendjoinrequest packet" << std::endl;
-    ENetPacket *packet =
-        enet_packet_create("JOIN", 5, ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(server, 0, packet); // Send packet to the server
+    WireWriter out;
+    writeJoinRequest(out);
+    sendPacket(RELIABLE_CHANNEL, out, ENET_PACKET_FLAG_RELIABLE);
   }
 
   void connect_client() {
-    if (!client) {
-      std::cerr << "Error: Client not initialized!" << std::endl;
-      return;
-    }
-
     std::cout << "Connecting to server..." << std::endl;
 
-    ENetAddress address;
-    enet_address_set_host(&address, SERVER_HOST);
-    address.port = SERVER_PORT;
-
-    server = enet_host_connect(client, &address, 2, 0);
-    if (!server) {
-      throw std::runtime_error("Failed to connect to server");
-    }
-
-    // Wait for connection success/failure
-    ENetEvent event;
-    if (enet_host_service(client, &event, 5000) > 0 &&
-        event.type == ENET_EVENT_TYPE_CONNECT) {
-      std::cout << "Connection to server succeeded!" << std::endl;
-    } else {
-      enet_peer_reset(server);
-      server = nullptr;
-      throw std::runtime_error("Connection to server failed!");
-    }
+    // Throws if the server doesn't answer within 5 seconds
+    network.connect(SERVER_HOST, SERVER_PORT, CHANNEL_COUNT, 5000);
+    std::cout << "Connection to server succeeded!" << std::endl;
 
     SDL_SetHint(SDL_HINT_MOUSE_RELATIVE_MODE_WARP, "1");
   }
@@ -755,26 +763,33 @@ public:
 
     // Initialize players vector with default states
     players.resize(2);
+    playerHistory.assign(players.size(), SnapshotHistory());
+    playerVisible.assign(players.size(), true);
     // player_count += 1;
     playerID = 0; // Will be set properly when connecting to server
 
-    // Load wall textures
-    const char *textureFiles[NUM_TEXTURES] = {"wall1.png", "wall2.png",
-                                              "wall3.png", "wall4.png"};
+    // Load one wall texture per wall type used in the map (wall1.png for
+    // type 1, wall2.png for type 2, ...) into the column-major store
+    int numTextures = 1;
+    for (int x = 0; x < MAP_WIDTH; x++) {
+      for (int y = 0; y < MAP_HEIGHT; y++) {
+        numTextures = std::max(numTextures, worldMap[x][y]);
+      }
+    }
 
-    for (int i = 0; i < NUM_TEXTURES; i++) {
-      SDL_Surface *tempSurface = IMG_Load(textureFiles[i]);
+    TextureStore wallTextures;
+    for (int i = 0; i < numTextures; i++) {
+      std::string textureFile = "wall" + std::to_string(i + 1) + ".png";
+      SDL_Surface *tempSurface = IMG_Load(textureFile.c_str());
       if (!tempSurface) {
         throw std::runtime_error("Failed to load wall texture: " +
                                  std::string(IMG_GetError()));
       }
-      wallTextures[i] = SDL_CreateTextureFromSurface(renderer, tempSurface);
+      wallTextures.add(loadPixelImage(tempSurface));
       SDL_FreeSurface(tempSurface);
-      if (!wallTextures[i]) {
-        throw std::runtime_error("Failed to create wall texture: " +
-                                 std::string(SDL_GetError()));
-      }
     }
+    raycaster.setWallTextures(wallTextures);
+    raycaster.setFloorTextures(FLOOR_TEXTURE, CEILING_TEXTURE);
 
     // Load player texture
     SDL_Surface *tempSurface = IMG_Load("player_texture.png");
@@ -791,72 +806,160 @@ public:
       std::cout << "Player texture loaded successfully!" << std::endl;
     }
   }
-  void processNetworkEvents() {
-    if (!client) {
-      std::cerr << "Error: ENet client host is not initialized!" << std::endl;
+  // Reset our own player to the server's state and replay the inputs it has
+  // not applied yet on top of it
+  void reconcile(const PositionPacket &pos) {
+    while (!pendingInputs.empty() &&
+           pendingInputs.front().sequence <= pos.lastInput) {
+      pendingInputs.pop_front();
+    }
+    players[playerID] = pos.state;
+    for (const InputPacket &input : pendingInputs) {
+      applyInput(players, playerID, input, tickDt);
+    }
+  }
+
+  void applyPosition(const PositionPacket &pos, double receivedAt) {
+    if (pos.playerID >= players.size())
       return;
+    if (pos.playerID == playerID) {
+      reconcile(pos);
+    } else {
+      players[pos.playerID] = pos.state;
     }
+    playerHistory[pos.playerID].push(receivedAt, pos.state);
+  }
 
-    ENetEvent event;
-    while (enet_host_service(client, &event, 0) > 0) {
-      // std::cerr << "new packet" << std::endl;
-      if (event.packet == nullptr) {
-        std::cerr << "Error: Received event with null packet!" << std::endl;
-        continue;
+  void handleSnapshot(WireReader &payload) {
+    NetSnapshot snapshot;
+    if (!readSnapshot(payload, receivedSnapshots, snapshot)) {
+      // Its baseline is gone; we keep acknowledging older snapshots until
+      // the server falls back to sending a full one
+      return;
+    }
+    receivedSnapshots.put(snapshot);
+    if (snapshot.tick <= latestSnapshotTick)
+      return; // Arrived after a newer one
+
+    const NetSnapshot *previous = receivedSnapshots.find(latestSnapshotTick);
+    latestSnapshotTick = snapshot.tick;
+    double now = clockSeconds();
+    for (size_t i = 0; i < snapshot.numPlayers && i < players.size(); i++) {
+      const NetPlayerState &entry = snapshot.players[i];
+      if (i != playerID) {
+        if (entry.hidden) {
+          playerVisible[i] = false;
+          playerHistory[i].clear();
+          continue;
+        }
+        playerVisible[i] = true;
+
+        // Distant players are only updated every few ticks, and a player
+        // standing still is sent unchanged. Either way the last state is
+        // held rather than stamped again, and when it changes the move is
+        // interpolated from at most one update interval back.
+        if (previous && i < previous->numPlayers &&
+            previous->players[i] == entry)
+          continue;
+        const TimedState *newest = playerHistory[i].newest();
+        double intervalStart = now - DISTANT_UPDATE_INTERVAL * tickDt;
+        if (newest && newest->time < intervalStart) {
+          playerHistory[i].push(intervalStart, newest->state);
+        }
       }
 
-      switch (event.type) {
-      // Handle receiving data from the server
-      case ENET_EVENT_TYPE_RECEIVE: {
-        if (event.packet->dataLength == sizeof(uint8_t)) {
-          // std::cout << "packet 1" << std::endl;
-          // This is the initial player ID assignment
-          playerID = *(uint8_t *)event.packet->data;
-          std::cout << "Assigned player ID: " << (int)playerID << std::endl;
-        } else if (event.packet->dataLength == sizeof(PositionPacket)) {
-          // std::cout << "packet 2" << std::endl;
-          // This is a position update (Player's position in the game)
-          PositionPacket *pos = (PositionPacket *)event.packet->data;
-          players[pos->playerID] = pos->state;
-
-        } else if (event.packet->dataLength == sizeof(HitNotificationPacket)) {
-          // std::cout << "packet 3" << std::endl;
-          // This is a hit notification
-          HitNotificationPacket *hit =
-              (HitNotificationPacket *)event.packet->data;
-          if (hit->targetID == playerID) {
-            std::cout << "You were hit by player " << hit->shooterID << "!"
-                      << std::endl;
-          } else if (hit->shooterID == playerID) {
-            std::cout << "You hit player " << hit->targetID << "!" << std::endl;
-          }
-        } else if (event.packet->dataLength == sizeof(LobbyUpdatePacket)) {
-          // std::cout << "packet 4" << std::endl;
-          if (event.packet->dataLength == sizeof(LobbyUpdatePacket)) {
-            LobbyUpdatePacket *lobbyUpdate =
-                (LobbyUpdatePacket *)event.packet->data;
-
-            std::cout << "Received Lobby Update Packet - Players: "
-                      << (int)lobbyUpdate->numPlayers << std::endl;
-
-            std::vector<PlayerState> playersInLobby;
-            for (size_t i = 0; i < lobbyUpdate->numPlayers; i++) {
-              playersInLobby.push_back(lobbyUpdate->players[i]);
-            }
+      PositionPacket pos;
+      pos.playerID = i;
+      pos.state = dequantizePlayer(snapshot.players[i]);
+      pos.lastInput = snapshot.players[i].lastInput;
+      applyPosition(pos, now);
+    }
+  }
 
-            lobby.updatePlayerList(playersInLobby);
+  void handleMessage(uint8_t type, WireReader &payload) {
+    switch (type) {
+    case WELCOME: {
+      // This is the initial player ID assignment
+      WelcomePacket welcome;
+      if (!readWelcome(payload, welcome))
+        break;
+      playerID = welcome.playerID;
+      tickDt = 1.0 / welcome.tickRate;
+      std::cout << "Assigned player ID: " << (int)playerID << " ("
+                << welcome.tickRate << " Hz server)" << std::endl;
+      break;
+    }
+    case SNAPSHOT:
+      handleSnapshot(payload);
+      break;
+    case PLAYER_POSITION: {
+      // This is a position update (Player's position in the game)
+      PositionPacket pos;
+      if (readPosition(payload, pos)) {
+        applyPosition(pos, clockSeconds());
+      }
+      break;
+    }
+    case HIT_NOTIFICATION: {
+      // This is a hit notification
+      HitNotificationPacket hit;
+      if (!readHitNotification(payload, hit))
+        break;
+      if (hit.targetID == playerID) {
+        std::cout << "You were hit by player " << hit.shooterID << "!"
+                  << std::endl;
+      } else if (hit.shooterID == playerID) {
+        std::cout << "You hit player " << hit.targetID << "!" << std::endl;
+      }
+      break;
+    }
+    case LOBBY_UPDATE: {
+      LobbyUpdatePacket lobbyUpdate;
+      if (!readLobbyUpdate(payload, lobbyUpdate))
+        break;
 
-            // updateLobby(playersInLobby);
-          }
+      std::cout << "Received Lobby Update Packet - Players: "
+                << (int)lobbyUpdate.numPlayers << std::endl;
 
-        } else if (event.packet->dataLength == sizeof(GameStartPacket)) {
-          std::cout << "packet 5" << std::endl;
-          // This is the "start game" signal from the admin
-          GameStartPacket *startPacket = (GameStartPacket *)event.packet->data;
-          if (startPacket->startGame) {
-            std::cout << "Game has started!" << std::endl;
-            gameState = PLAYING; // Switch to PLAYING state
-          }
+      std::vector<PlayerState> playersInLobby(
+          lobbyUpdate.players, lobbyUpdate.players + lobbyUpdate.numPlayers);
+      lobby->updatePlayerList(playersInLobby);
+      break;
+    }
+    case GAME_START: {
+      // This is the "start game" signal from the admin
+      GameStartPacket startPacket;
+      if (readGameStart(payload, startPacket) && startPacket.startGame) {
+        std::cout << "Game has started!" << std::endl;
+        gameState = PLAYING; // Switch to PLAYING state
+      }
+      break;
+    }
+    default:
+      std::cerr << "Ignoring message of unknown type " << (int)type
+                << std::endl;
+      break;
+    }
+  }
+
+  void processNetworkEvents() {
+    PROFILE_SCOPE("network");
+    // Everything the network thread received since the last frame
+    NetEvent event;
+    while (network.poll(event)) {
+      switch (event.type) {
+      // Handle receiving data from the server
+      case ENET_EVENT_TYPE_RECEIVE: {
+        if (event.packet == nullptr) {
+          std::cerr << "Error: Received event with null packet!" << std::endl;
+          break;
+        }
+        MessageIterator messages(event.packet->data,
+                                 event.packet->dataLength);
+        uint8_t type;
+        WireReader payload;
+        while (messages.next(type, payload)) {
+          handleMessage(type, payload);
         }
         // Free the received packet after processing
         enet_packet_destroy(event.packet);
@@ -873,10 +976,17 @@ public:
   }
 
   ~GameClient() {
+    // UI textures belong to the renderer, release them before it goes
+    profilerOverlay.reset();
+    lobby.reset();
+    menu.reset();
+    text.reset();
+
     SDL_DestroyTexture(playerTexture);
-    for (int i = 0; i < NUM_TEXTURES; i++) {
-      SDL_DestroyTexture(wallTextures[i]);
+    if (minimapLayer) {
+      SDL_DestroyTexture(minimapLayer);
     }
+    destroyFramebuffer(framebuffer);
     // SDL_DestroyTexture(playerTexture);
     // playerSprite.free();
 
@@ -885,32 +995,9 @@ public:
       playerSprite.texture = nullptr;
     }
 
-    if (server) { // ✅ Ensure `server` is valid before disconnecting
-      enet_peer_disconnect(server, 0);
-      enet_peer_reset(server);
-      server = nullptr; // ✅ Prevent double-free issues
-    }
-
-    if (client) {
-      ENetEvent event;
-      while (enet_host_service(client, &event, 3000) > 0) {
-        switch (event.type) {
-        case ENET_EVENT_TYPE_RECEIVE:
-          enet_packet_destroy(event.packet);
-          break;
-        case ENET_EVENT_TYPE_DISCONNECT:
-          std::cout << "Disconnection succeeded." << std::endl;
-          goto cleanup;
-        default:
-          break;
-        }
-      }
-    }
-  cleanup:
-    if (client) {
-      enet_host_destroy(client);
-      client = nullptr;
-    }
+    // Stops the network thread, then waits up to 3 seconds for the server
+    // to acknowledge the disconnect
+    network.disconnect(3000);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     IMG_Quit(); // ✅ Properly quit SDL2_Image
@@ -929,7 +1016,28 @@ public:
 //     }
 // }
 
-int main() {
+int main(int argc, char *argv[]) {
+  ClientConfig config;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      config.renderThreads = std::atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--frame-budget") == 0 && i + 1 < argc) {
+      config.frameBudgetMs = std::atof(argv[++i]);
+    } else if (strcmp(argv[i], "--interp-delay") == 0 && i + 1 < argc) {
+      config.interpolationDelayMs = std::atof(argv[++i]);
+    } else if (strcmp(argv[i], "--no-vsync") == 0) {
+      config.vsync = false;
+    } else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+      config.maxFps = std::atoi(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--threads N] [--frame-budget MS] [--interp-delay MS]"
+                   " [--no-vsync] [--fps N]"
+                << std::endl;
+      return -1;
+    }
+  }
+
   if (SDL_Init(SDL_INIT_VIDEO) < 0) {
     std::cerr << "SDL Initialization failed: " << SDL_GetError() << std::endl;
     return -1;
@@ -941,7 +1049,7 @@ int main() {
     return -1;
   }
 
-  GameClient client;
+  GameClient client(config);
   client.run();
 
   // Cleanup
@@ -1,40 +1,27 @@
 
 #pragma once
 #include <cstdint>
+#include "Map.h"
 #include <enet/enet.h>
 #include <SDL2/SDL.h>
 #include <string>
 
-const int MAP_WIDTH = 24;
-const int MAP_HEIGHT = 24;
-
-const int worldMap[MAP_WIDTH][MAP_HEIGHT] = {
-    {4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
-    {4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 3, 3, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4},
-    {4, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4}};
-
-enum PacketType { PLAYER_POSITION = 1, PLAYER_INPUT };
+// Message types, the first byte of every message on the wire (see
+// WireFormat.h and Protocol.h)
+enum PacketType {
+  PLAYER_POSITION = 1,
+  PLAYER_INPUT,
+  WELCOME,
+  SNAPSHOT,
+  SHOT_ATTEMPT,
+  HIT_NOTIFICATION,
+  LOBBY_UPDATE,
+  GAME_START,
+  JOIN_REQUEST
+};
+
+// Server simulation steps per second unless started with --tick-rate
+const int DEFAULT_TICK_RATE = 60;
 
 const int SCREEN_WIDTH = 1024;
 const int SCREEN_HEIGHT = 768;
@@ -54,12 +41,15 @@ bool isAdmin;
   bool isMoving;
     
   PlayerState()
-      : posX(2.0), posY(2.0), dirX(-1.0), dirY(0.0), planeX(0.0), planeY(0.66),
+      : isAdmin(false), posX(2.0), posY(2.0), dirX(-1.0), dirY(0.0), planeX(0.0), planeY(0.66),
         isMoving(false) {}
 };
 
+// Most mouse turn one input may carry, in radians. Anything larger is a
+// corrupt or hostile message.
+const double MAX_MOUSE_ROTATION = 3.14159265358979323846;
+
 struct InputPacket {
-  uint8_t type = PLAYER_INPUT;
   bool forward;
   bool backward;
   bool strafeLeft;
@@ -67,6 +57,17 @@ struct InputPacket {
   bool turnLeft;
   bool turnRight;
   double mouseRotation;
+  uint32_t sequence;   // Increases by one per input (one per tick), from 1
+  uint32_t clientTick; // Client tick the input was sampled on
+};
+
+// Inputs are sent in batches of the newest few, so each one goes out
+// INPUT_REDUNDANCY times and a lost datagram or two loses nothing
+const size_t INPUT_REDUNDANCY = 4;
+struct InputBatchPacket {
+  uint32_t ackTick; // Newest snapshot received, the server's next baseline
+  uint8_t count;    // Inputs in use, oldest first
+  InputPacket inputs[INPUT_REDUNDANCY];
 };
 
 struct ShotAttemptPacket {
@@ -89,15 +90,36 @@ struct HitNotificationPacket {
 };
 
 struct PositionPacket {
-  uint8_t type = PLAYER_POSITION;
   uint8_t playerID;
   PlayerState state;
+  uint32_t lastInput; // Sequence of the last input applied to this player
+};
+
+// Most players one snapshot can describe
+const size_t MAX_SNAPSHOT_PLAYERS = 4;
+// Players a client can see but who are far away are only updated every
+// this many ticks
+const uint32_t DISTANT_UPDATE_INTERVAL = 4;
+
+// ENet channels. Movement inputs and snapshots are sent unreliable and
+// sequenced: a lost one is superseded by the next and a late one is dropped,
+// so loss never holds newer movement back. Hits, lobby updates and the rest
+// are reliable and never wait behind movement.
+const enet_uint8 RELIABLE_CHANNEL = 0;
+const enet_uint8 MOVEMENT_CHANNEL = 1;
+const int CHANNEL_COUNT = 2;
+
+// First packet a client receives: its player slot and the server tick rate
+struct WelcomePacket {
+  uint8_t playerID;
+  uint16_t tickRate; // Simulation steps, and snapshots, per second
 };
 
 // Packet to update the lobby with players' info
+const size_t MAX_LOBBY_PLAYERS = 4;
 struct LobbyUpdatePacket {
     uint8_t numPlayers;  // Number of players in the lobby
-    PlayerState players[4];    // Array of players in the lobby
+    PlayerState players[MAX_LOBBY_PLAYERS];    // Array of players in the lobby
 };
 
 // Packet to start the game
@@ -0,0 +1,434 @@
+// Headless load generator for server capacity testing. Opens many ENet
+// connections to a server, each one a bot that joins like a real client,
+// walks around at random, turns, shoots now and then, and acknowledges
+// snapshots so the server delta-encodes for it as usual. Bots are added in
+// steps, and after each step a row of the capacity report is printed:
+// players against round-trip time, snapshot rate and loss, the tick rate
+// the server actually achieved and the bandwidth it sent. Run the server
+// with --stats to log its tick time alongside.
+#include "Protocol.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <enet/enet.h>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+const int DEFAULT_PORT = 1234;
+const double SHOT_INTERVAL = 2.0;     // Average seconds between shots
+const double MIN_MOVE_SECONDS = 0.3;  // How long a bot keeps the same keys
+const double MAX_MOVE_SECONDS = 2.0;
+const double MAX_TURN_PER_INPUT = 0.05; // Radians of mouse movement
+const enet_uint32 CONNECT_TIMEOUT_MS = 5000;
+
+// One simulated player
+struct Bot {
+    ENetPeer* peer;
+    bool connected;
+    bool welcomed;
+    uint8_t playerID;
+    double tickDt; // From the welcome
+
+    // Inputs, sent once per server tick in redundant batches like the client
+    InputPacket keys; // Current movement keys
+    std::deque<InputPacket> recentInputs;
+    uint32_t nextSequence;
+    double nextInputTime;
+    double nextKeyChange;
+    double nextShot;
+
+    SnapshotRing snapshots;
+    uint32_t latestTick;
+    PlayerState state; // Our own player, from the latest snapshot
+
+    // Counters for the current report step
+    uint32_t firstTick; // First snapshot tick seen this step, 0 = none yet
+    uint32_t lastTick;
+    size_t snapshotsReceived;
+    size_t bytesReceived;
+};
+
+// Everything measured over one step of the ramp
+struct StepReport {
+    size_t bots;
+    size_t connected;
+    double rttAverage;
+    double rttP99;
+    double snapshotRate; // Per bot per second
+    double lossPercent;  // Snapshot ticks never received
+    double serverTickRate;
+    double kbPerSecond; // Received by all bots
+};
+
+class LoadGenerator {
+public:
+    LoadGenerator(const char* hostName, int port, size_t maxBots, unsigned seed)
+        : random(seed), maxBots(maxBots) {
+        if (enet_initialize() != 0) {
+            throw std::runtime_error("Failed to initialize ENet");
+        }
+        host = enet_host_create(nullptr, maxBots, CHANNEL_COUNT, 0, 0);
+        if (!host) {
+            throw std::runtime_error("Failed to create ENet client host");
+        }
+        if (enet_address_set_host(&address, hostName) != 0) {
+            throw std::runtime_error(std::string("Unknown host ") + hostName);
+        }
+        address.port = port;
+        bots.reserve(maxBots);
+    }
+
+    ~LoadGenerator() {
+        for (Bot& bot : bots) {
+            if (bot.connected) {
+                enet_peer_disconnect_now(bot.peer, 0);
+            }
+        }
+        enet_host_destroy(host);
+        enet_deinitialize();
+    }
+
+    // Start count more bots; they connect in the background
+    void addBots(size_t count) {
+        for (size_t i = 0; i < count && bots.size() < maxBots; i++) {
+            ENetPeer* peer = enet_host_connect(host, &address, CHANNEL_COUNT, 0);
+            if (!peer) {
+                std::cerr << "No free peer for bot " << bots.size() << std::endl;
+                return;
+            }
+            peer->data = (void*)bots.size();
+            enet_peer_timeout(peer, 0, CONNECT_TIMEOUT_MS, CONNECT_TIMEOUT_MS);
+
+            Bot bot;
+            memset(&bot.keys, 0, sizeof(bot.keys));
+            bot.peer = peer;
+            bot.connected = false;
+            bot.welcomed = false;
+            bot.playerID = 0;
+            bot.tickDt = 1.0 / DEFAULT_TICK_RATE;
+            bot.nextSequence = 1;
+            bot.nextInputTime = 0.0;
+            bot.nextKeyChange = 0.0;
+            bot.nextShot = 0.0;
+            bot.latestTick = 0;
+            bots.push_back(bot);
+            resetCounters(bots.back());
+        }
+    }
+
+    // Run the bots for the given number of seconds and report on that time
+    StepReport runStep(double seconds) {
+        for (Bot& bot : bots) {
+            resetCounters(bot);
+        }
+        Clock::time_point start = Clock::now();
+        double elapsed = 0.0;
+        while (elapsed < seconds) {
+            double now = clockSeconds();
+            for (Bot& bot : bots) {
+                updateBot(bot, now);
+            }
+
+            // Wake at least once a millisecond to keep inputs on time
+            ENetEvent event;
+            int result = enet_host_service(host, &event, 1);
+            while (result > 0) {
+                handleEvent(event);
+                result = enet_host_check_events(host, &event);
+            }
+            if (result < 0) {
+                std::cerr << "ENet service failed" << std::endl;
+            }
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        }
+        return report(elapsed);
+    }
+
+private:
+    ENetHost* host;
+    ENetAddress address;
+    std::mt19937 random;
+    size_t maxBots;
+    std::vector<Bot> bots;
+
+    static double clockSeconds() {
+        return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+    }
+
+    double uniform(double low, double high) {
+        return std::uniform_real_distribution<double>(low, high)(random);
+    }
+
+    static void resetCounters(Bot& bot) {
+        bot.firstTick = 0;
+        bot.lastTick = 0;
+        bot.snapshotsReceived = 0;
+        bot.bytesReceived = 0;
+    }
+
+    void send(Bot& bot, enet_uint8 channel, const WireWriter& out, enet_uint32 flags) {
+        ENetPacket* packet = enet_packet_create(out.bytes().data(), out.bytes().size(), flags);
+        if (packet && enet_peer_send(bot.peer, channel, packet) < 0) {
+            enet_packet_destroy(packet);
+        }
+    }
+
+    // A random walk: hold some keys for a while, then pick others
+    void updateBot(Bot& bot, double now) {
+        if (!bot.welcomed) {
+            return;
+        }
+
+        if (now >= bot.nextKeyChange) {
+            int keys = std::uniform_int_distribution<int>(0, 63)(random);
+            bot.keys.forward = (keys & 1) != 0;
+            bot.keys.backward = (keys & 2) != 0 && !bot.keys.forward;
+            bot.keys.strafeLeft = (keys & 4) != 0;
+            bot.keys.strafeRight = (keys & 8) != 0 && !bot.keys.strafeLeft;
+            bot.keys.turnLeft = (keys & 16) != 0;
+            bot.keys.turnRight = (keys & 32) != 0 && !bot.keys.turnLeft;
+            bot.nextKeyChange = now + uniform(MIN_MOVE_SECONDS, MAX_MOVE_SECONDS);
+        }
+
+        // One input per server tick, like the client
+        if (now >= bot.nextInputTime) {
+            InputPacket input = bot.keys;
+            input.mouseRotation = uniform(-MAX_TURN_PER_INPUT, MAX_TURN_PER_INPUT);
+            input.sequence = bot.nextSequence++;
+            input.clientTick = input.sequence;
+            bot.recentInputs.push_back(input);
+            if (bot.recentInputs.size() > INPUT_REDUNDANCY) {
+                bot.recentInputs.pop_front();
+            }
+
+            InputBatchPacket batch;
+            batch.ackTick = bot.latestTick;
+            batch.count = uint8_t(bot.recentInputs.size());
+            std::copy(bot.recentInputs.begin(), bot.recentInputs.end(), batch.inputs);
+            WireWriter out;
+            writeInputBatch(out, batch);
+            send(bot, MOVEMENT_CHANNEL, out, 0);
+
+            bot.nextInputTime += bot.tickDt;
+            if (bot.nextInputTime < now) {
+                bot.nextInputTime = now + bot.tickDt; // Fell behind; don't burst
+            }
+        }
+
+        if (now >= bot.nextShot) {
+            ShotAttemptPacket shot;
+            shot.shooterID = bot.playerID;
+            shot.shooterPosX = bot.state.posX;
+            shot.shooterPosY = bot.state.posY;
+            shot.shooterDirX = bot.state.dirX;
+            shot.shooterDirY = bot.state.dirY;
+            WireWriter out;
+            writeShotAttempt(out, shot);
+            send(bot, RELIABLE_CHANNEL, out, ENET_PACKET_FLAG_RELIABLE);
+            bot.nextShot = now + uniform(0.5, 1.5) * SHOT_INTERVAL;
+        }
+    }
+
+    void handleEvent(ENetEvent& event) {
+        Bot& bot = bots[(size_t)event.peer->data];
+        switch (event.type) {
+        case ENET_EVENT_TYPE_CONNECT: {
+            bot.connected = true;
+            WireWriter out;
+            writeJoinRequest(out);
+            send(bot, RELIABLE_CHANNEL, out, ENET_PACKET_FLAG_RELIABLE);
+            break;
+        }
+        case ENET_EVENT_TYPE_RECEIVE: {
+            bot.bytesReceived += event.packet->dataLength;
+            MessageIterator messages(event.packet->data, event.packet->dataLength);
+            uint8_t type;
+            WireReader payload;
+            while (messages.next(type, payload)) {
+                handleMessage(bot, type, payload);
+            }
+            enet_packet_destroy(event.packet);
+            break;
+        }
+        case ENET_EVENT_TYPE_DISCONNECT:
+            bot.connected = false;
+            bot.welcomed = false;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void handleMessage(Bot& bot, uint8_t type, WireReader& payload) {
+        switch (type) {
+        case WELCOME: {
+            WelcomePacket welcome;
+            if (readWelcome(payload, welcome)) {
+                bot.playerID = welcome.playerID;
+                bot.tickDt = 1.0 / welcome.tickRate;
+                bot.welcomed = true;
+                // Spread the bots' inputs across the tick
+                double now = clockSeconds();
+                bot.nextInputTime = now + uniform(0.0, bot.tickDt);
+                bot.nextShot = now + uniform(0.0, SHOT_INTERVAL);
+            }
+            break;
+        }
+        case SNAPSHOT: {
+            NetSnapshot snapshot;
+            if (!readSnapshot(payload, bot.snapshots, snapshot)) {
+                break; // Baseline gone; counted as lost
+            }
+            bot.snapshots.put(snapshot);
+            if (snapshot.tick <= bot.latestTick) {
+                break;
+            }
+            bot.latestTick = snapshot.tick;
+            if (bot.playerID < snapshot.numPlayers) {
+                bot.state = dequantizePlayer(snapshot.players[bot.playerID]);
+            }
+            if (bot.firstTick == 0) {
+                bot.firstTick = snapshot.tick;
+            }
+            bot.lastTick = snapshot.tick;
+            bot.snapshotsReceived++;
+            break;
+        }
+        default:
+            break; // Everything else is for the renderer
+        }
+    }
+
+    StepReport report(double seconds) {
+        StepReport result;
+        memset(&result, 0, sizeof(result));
+        result.bots = bots.size();
+
+        std::vector<double> rtts;
+        size_t received = 0, expected = 0, bytes = 0;
+        double tickRateSum = 0.0;
+        for (const Bot& bot : bots) {
+            bytes += bot.bytesReceived;
+            if (!bot.connected) {
+                continue;
+            }
+            result.connected++;
+            rtts.push_back(bot.peer->roundTripTime);
+            if (bot.firstTick != 0) {
+                received += bot.snapshotsReceived;
+                expected += bot.lastTick - bot.firstTick + 1;
+                tickRateSum += (bot.lastTick - bot.firstTick) / seconds;
+            }
+        }
+
+        if (!rtts.empty()) {
+            std::sort(rtts.begin(), rtts.end());
+            double sum = 0.0;
+            for (double rtt : rtts) {
+                sum += rtt;
+            }
+            result.rttAverage = sum / rtts.size();
+            result.rttP99 = rtts[std::min(rtts.size() - 1, rtts.size() * 99 / 100)];
+            result.snapshotRate = received / seconds / rtts.size();
+            result.serverTickRate = tickRateSum / rtts.size();
+        }
+        if (expected > 0) {
+            result.lossPercent = 100.0 * (expected - received) / expected;
+        }
+        result.kbPerSecond = bytes / 1024.0 / seconds;
+        return result;
+    }
+};
+
+int main(int argc, char** argv) {
+    std::string hostName = "localhost";
+    int port = DEFAULT_PORT;
+    long maxBots = 200;
+    long step = 50;
+    double stepSeconds = 10.0;
+    unsigned seed = 1234;
+    std::string csvPath;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--host" && i + 1 < argc) {
+            hostName = argv[++i];
+        } else if (arg == "--port" && i + 1 < argc) {
+            port = std::atoi(argv[++i]);
+        } else if (arg == "--bots" && i + 1 < argc) {
+            maxBots = std::max(1L, std::atol(argv[++i]));
+        } else if (arg == "--step" && i + 1 < argc) {
+            step = std::max(1L, std::atol(argv[++i]));
+        } else if (arg == "--step-seconds" && i + 1 < argc) {
+            stepSeconds = std::max(1.0, std::atof(argv[++i]));
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = (unsigned)std::atol(argv[++i]);
+        } else if (arg == "--csv" && i + 1 < argc) {
+            csvPath = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--host NAME] [--port N] [--bots N] [--step N] [--step-seconds S]"
+                         " [--seed N] [--csv FILE]"
+                      << std::endl;
+            return -1;
+        }
+    }
+
+    FILE* csv = nullptr;
+    if (!csvPath.empty()) {
+        csv = fopen(csvPath.c_str(), "w");
+        if (!csv) {
+            std::cerr << "Failed to open " << csvPath << std::endl;
+            return 1;
+        }
+        fprintf(csv, "bots,connected,rtt_avg_ms,rtt_p99_ms,snapshots_per_s,loss_percent,"
+                     "server_ticks_per_s,kb_per_s,kb_per_s_per_player\n");
+    }
+
+    try {
+        LoadGenerator generator(hostName.c_str(), port, (size_t)maxBots, seed);
+        std::cout << "Ramping to " << maxBots << " bots on " << hostName << ":" << port
+                  << ", " << step << " more every " << stepSeconds << " s" << std::endl;
+        std::cout << std::setw(6) << "bots" << std::setw(7) << "conn" << std::setw(9) << "rtt ms"
+                  << std::setw(9) << "p99 ms" << std::setw(9) << "snap/s" << std::setw(8)
+                  << "loss %" << std::setw(9) << "tick/s" << std::setw(10) << "kB/s"
+                  << std::setw(12) << "kB/s/player" << std::endl;
+
+        for (long bots = step; bots < maxBots + step; bots += step) {
+            generator.addBots((size_t)std::min(step, maxBots - (bots - step)));
+            StepReport row = generator.runStep(stepSeconds);
+            double perPlayer = row.connected ? row.kbPerSecond / row.connected : 0.0;
+
+            std::cout << std::fixed << std::setprecision(1) << std::setw(6) << row.bots
+                      << std::setw(7) << row.connected << std::setw(9) << row.rttAverage
+                      << std::setw(9) << row.rttP99 << std::setw(9) << row.snapshotRate
+                      << std::setw(8) << row.lossPercent << std::setw(9) << row.serverTickRate
+                      << std::setw(10) << row.kbPerSecond << std::setw(12) << perPlayer
+                      << std::endl;
+            if (csv) {
+                fprintf(csv, "%zu,%zu,%.1f,%.1f,%.2f,%.2f,%.2f,%.1f,%.2f\n", row.bots,
+                        row.connected, row.rttAverage, row.rttP99, row.snapshotRate,
+                        row.lossPercent, row.serverTickRate, row.kbPerSecond, perPlayer);
+                fflush(csv);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        if (csv) {
+            fclose(csv);
+        }
+        return 1;
+    }
+    if (csv) {
+        fclose(csv);
+    }
+    return 0;
+}
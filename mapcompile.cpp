@@ -0,0 +1,232 @@
+// Map compile step. Precomputes which cells of worldMap can possibly see
+// which others and writes the result as a bitset header, MapVisibility.h,
+// next to Map.h. Run through `make MapVisibility.h` after changing the map.
+#include "LineOfSight.h"
+#include "Map.h"
+#include "Visibility.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+// The table must be conservative: a pair marked visible that cannot really
+// see each other only costs a DDA at run time, but a pair wrongly marked
+// invisible culls a player who is in plain sight and rejects a real hit. So
+// false positives are allowed and false negatives are not.
+//
+// A position is in cell (x, y) when x <= posX < x + 1, likewise for y, so
+// cells are tested as [x, x + 1 - CELL_INSET] and the far edges, which no one
+// can stand on, do not count. Walls are shrunk by WALL_INSET on the sides
+// that face open cells. Any line clear of the real walls from a point in one
+// cell to a point in the other then moves by less than WALL_INSET when its
+// ends are pulled into the inset cells, so it stays clear of the shrunk walls
+// and the exact test below finds it. Lines that only graze a wall, which the
+// run-time DDA may let through after rounding, count as clear too.
+const double CELL_INSET = 1e-7;
+const double WALL_INSET = 1e-6;
+
+// Points tried in each cell, from edge to edge. Any clear line between a
+// point of one cell and a point of the other proves the pair visible; this
+// settles most visible pairs quickly.
+const double SAMPLE_OFFSETS[] = {0.01, 0.25, 0.5, 0.75, 0.99};
+const int SAMPLES_PER_AXIS = sizeof(SAMPLE_OFFSETS) / sizeof(SAMPLE_OFFSETS[0]);
+
+struct Point {
+    double x, y;
+};
+
+struct Box {
+    double minX, minY, maxX, maxY;
+};
+
+static Box cellBox(int x, int y) {
+    Box box = {double(x), double(y), x + 1 - CELL_INSET, y + 1 - CELL_INSET};
+    return box;
+}
+
+static bool isWall(int x, int y) {
+    return x < 0 || x >= MAP_WIDTH || y < 0 || y >= MAP_HEIGHT || worldMap[x][y] > 0;
+}
+
+// A wall cell shrunk only on the sides that face open cells, so no crack
+// opens between neighbouring walls
+static Box wallBox(int x, int y) {
+    Box box = {x + (isWall(x - 1, y) ? 0.0 : WALL_INSET), y + (isWall(x, y - 1) ? 0.0 : WALL_INSET),
+               x + 1 - (isWall(x + 1, y) ? 0.0 : WALL_INSET),
+               y + 1 - (isWall(x, y + 1) ? 0.0 : WALL_INSET)};
+    return box;
+}
+
+static bool samplesCanSee(int ax, int ay, int bx, int by) {
+    for (int i = 0; i < SAMPLES_PER_AXIS * SAMPLES_PER_AXIS; i++) {
+        double startX = ax + SAMPLE_OFFSETS[i / SAMPLES_PER_AXIS];
+        double startY = ay + SAMPLE_OFFSETS[i % SAMPLES_PER_AXIS];
+        for (int j = 0; j < SAMPLES_PER_AXIS * SAMPLES_PER_AXIS; j++) {
+            double endX = bx + SAMPLE_OFFSETS[j / SAMPLES_PER_AXIS];
+            double endY = by + SAMPLE_OFFSETS[j % SAMPLES_PER_AXIS];
+            if (!hasWallBetweenPoints(startX, startY, endX, endY) ||
+                !hasWallBetweenPoints(endX, endY, startX, startY)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Clip the line from + t * dir to a box; false if it misses. A line along an
+// edge of the box counts as inside it.
+static bool clipToBox(Point from, Point dir, const Box& box, double& t0, double& t1) {
+    t0 = -1e30;
+    t1 = 1e30;
+    const double origin[2] = {from.x, from.y};
+    const double delta[2] = {dir.x, dir.y};
+    const double low[2] = {box.minX, box.minY};
+    const double high[2] = {box.maxX, box.maxY};
+    for (int axis = 0; axis < 2; axis++) {
+        if (delta[axis] == 0.0) {
+            if (origin[axis] < low[axis] || origin[axis] > high[axis])
+                return false;
+            continue;
+        }
+        double enter = (low[axis] - origin[axis]) / delta[axis];
+        double leave = (high[axis] - origin[axis]) / delta[axis];
+        if (enter > leave)
+            std::swap(enter, leave);
+        t0 = std::max(t0, enter);
+        t1 = std::min(t1, leave);
+    }
+    return t0 <= t1;
+}
+
+// Whether the line through u and v meets both cells with nothing solid on
+// the stretch between them
+static bool lineSeesBetween(Point u, Point v, const Box& a, const Box& b,
+                            const std::vector<Box>& walls) {
+    Point dir = {v.x - u.x, v.y - u.y};
+    double aStart, aEnd, bStart, bEnd;
+    if (!clipToBox(u, dir, a, aStart, aEnd) || !clipToBox(u, dir, b, bStart, bEnd))
+        return false;
+    if (aEnd >= bStart && bEnd >= aStart)
+        return true; // The cells touch along the line
+    double from = aEnd < bStart ? aEnd : bEnd;
+    double to = aEnd < bStart ? bStart : aStart;
+
+    // Running along a wall's edge or through its corner is not crossing it
+    for (const Box& wall : walls) {
+        if ((dir.x == 0.0 && (u.x <= wall.minX || u.x >= wall.maxX)) ||
+            (dir.y == 0.0 && (u.y <= wall.minY || u.y >= wall.maxY))) {
+            continue;
+        }
+        double wallStart, wallEnd;
+        if (clipToBox(u, dir, wall, wallStart, wallEnd) &&
+            std::min(to, wallEnd) - std::max(from, wallStart) > 1e-12) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Exact test. If any clear line joins the two cells, it can be slid and
+// turned, staying clear, until it passes through two corners of the cells
+// or of the walls near them; so trying the line through every pair of such
+// corners finds one whenever the cells can see each other.
+static bool cornersCanSee(int ax, int ay, int bx, int by) {
+    Box a = cellBox(ax, ay);
+    Box b = cellBox(bx, by);
+
+    // Any line between the cells stays inside their bounding box
+    std::vector<Box> walls;
+    std::vector<Point> corners;
+    for (int x = std::min(ax, bx); x <= std::max(ax, bx); x++) {
+        for (int y = std::min(ay, by); y <= std::max(ay, by); y++) {
+            if (worldMap[x][y] > 0)
+                walls.push_back(wallBox(x, y));
+        }
+    }
+    const Box* boxes[2] = {&a, &b};
+    for (const Box* box : boxes) {
+        corners.push_back({box->minX, box->minY});
+        corners.push_back({box->maxX, box->minY});
+        corners.push_back({box->minX, box->maxY});
+        corners.push_back({box->maxX, box->maxY});
+    }
+    for (const Box& wall : walls) {
+        corners.push_back({wall.minX, wall.minY});
+        corners.push_back({wall.maxX, wall.minY});
+        corners.push_back({wall.minX, wall.maxY});
+        corners.push_back({wall.maxX, wall.maxY});
+    }
+
+    for (size_t i = 0; i < corners.size(); i++) {
+        for (size_t j = i + 1; j < corners.size(); j++) {
+            if (lineSeesBetween(corners[i], corners[j], a, b, walls))
+                return true;
+        }
+    }
+    return false;
+}
+
+static bool cellsCanSee(int ax, int ay, int bx, int by) {
+    return samplesCanSee(ax, ay, bx, by) || cornersCanSee(ax, ay, bx, by);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " OUTPUT_HEADER" << std::endl;
+        return -1;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<uint32_t> bits(PVS_CELLS * PVS_ROW_WORDS, 0);
+    auto set = [&](int from, int to) { bits[from * PVS_ROW_WORDS + to / 32] |= 1u << (to % 32); };
+
+    size_t openPairs = 0;
+    size_t visiblePairs = 0;
+    for (int a = 0; a < PVS_CELLS; a++) {
+        int ax = a / MAP_HEIGHT;
+        int ay = a % MAP_HEIGHT;
+        for (int b = a; b < PVS_CELLS; b++) {
+            int bx = b / MAP_HEIGHT;
+            int by = b % MAP_HEIGHT;
+            // Nothing stands inside a wall, but if anything asks it gets the
+            // exact test rather than a wrong answer
+            bool open = worldMap[ax][ay] == 0 && worldMap[bx][by] == 0;
+            bool visible = !open || a == b || cellsCanSee(ax, ay, bx, by);
+            if (open) {
+                openPairs++;
+                visiblePairs += visible ? 1 : 0;
+            }
+            if (visible) {
+                set(a, b);
+                set(b, a);
+            }
+        }
+    }
+    double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    FILE* out = fopen(argv[1], "w");
+    if (!out) {
+        std::cerr << "Failed to open " << argv[1] << std::endl;
+        return 1;
+    }
+    fprintf(out, "// Generated by mapcompile from Map.h; do not edit. Run `make MapVisibility.h`\n");
+    fprintf(out, "// after changing the map.\n");
+    fprintf(out, "#pragma once\n\n#include <cstdint>\n\n");
+    fprintf(out, "// Checksum of the worldMap this was built from\n");
+    fprintf(out, "const uint32_t MAP_PVS_CHECKSUM = 0x%08xu;\n\n", mapChecksum());
+    fprintf(out, "// Row per cell (x * MAP_HEIGHT + y), one bit per cell it may see\n");
+    fprintf(out, "const uint32_t MAP_PVS[%d * %d] = {\n", PVS_CELLS, PVS_ROW_WORDS);
+    for (size_t i = 0; i < bits.size(); i++) {
+        fprintf(out, "%s0x%08x,%s", i % 6 == 0 ? "    " : "", bits[i],
+                i % 6 == 5 || i + 1 == bits.size() ? "\n" : " ");
+    }
+    fprintf(out, "};\n");
+    fclose(out);
+
+    std::cout << "Wrote " << argv[1] << ": " << visiblePairs << " of " << openPairs
+              << " open cell pairs visible, " << bits.size() * sizeof(uint32_t) << " bytes, "
+              << seconds << " s" << std::endl;
+    return 0;
+}
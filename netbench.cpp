@@ -0,0 +1,177 @@
+// Benchmark for the network message layer. Encodes and decodes the messages
+// the game sends most often, through the same WireWriter, MessageIterator
+// and Protocol.h functions the client and server use, and reports the bytes
+// on the wire and the time per message each way.
+#include "Protocol.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+typedef std::chrono::steady_clock Clock;
+
+struct BenchCase {
+    const char* name;
+    size_t rawSize; // sizeof() of the struct(s) that used to be sent as-is
+    std::function<void(WireWriter&)> write;
+    std::function<bool(uint8_t, WireReader&)> read;
+};
+
+// Players spread around the open middle of the map, looking different ways
+static PlayerState makePlayer(int index, double t) {
+    PlayerState state;
+    double angle = index * 1.7 + t;
+    state.posX = 12.0 + 3.0 * cos(t + index);
+    state.posY = 12.0 + 3.0 * sin(t * 0.7 + index);
+    state.dirX = cos(angle);
+    state.dirY = sin(angle);
+    state.planeX = state.dirY * CAMERA_PLANE_LENGTH;
+    state.planeY = -state.dirX * CAMERA_PLANE_LENGTH;
+    state.isMoving = true;
+    return state;
+}
+
+static NetSnapshot makeSnapshot(uint32_t tick) {
+    NetSnapshot snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.tick = tick;
+    snapshot.numPlayers = MAX_SNAPSHOT_PLAYERS;
+    for (size_t i = 0; i < MAX_SNAPSHOT_PLAYERS; i++) {
+        snapshot.players[i] = quantizePlayer(makePlayer(int(i), tick / 60.0), tick);
+    }
+    return snapshot;
+}
+
+int main(int argc, char** argv) {
+    long iterations = 1000000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::max(1L, std::atol(argv[++i]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--iterations N]" << std::endl;
+            return -1;
+        }
+    }
+
+    // Baseline six ticks (100 ms at 60 Hz) behind, a typical ack delay
+    const uint32_t TICK = 1000;
+    NetSnapshot snapshot = makeSnapshot(TICK);
+    NetSnapshot baseline = makeSnapshot(TICK - 6);
+    SnapshotRing history;
+    history.put(baseline);
+
+    InputBatchPacket batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.ackTick = TICK;
+    batch.count = INPUT_REDUNDANCY;
+    for (size_t i = 0; i < INPUT_REDUNDANCY; i++) {
+        batch.inputs[i].forward = true;
+        batch.inputs[i].strafeLeft = i % 2 == 0;
+        batch.inputs[i].mouseRotation = 0.0008 * i;
+        batch.inputs[i].sequence = TICK + i;
+        batch.inputs[i].clientTick = TICK + i;
+    }
+
+    LobbyUpdatePacket lobbyUpdate;
+    lobbyUpdate.numPlayers = MAX_LOBBY_PLAYERS;
+    for (size_t i = 0; i < MAX_LOBBY_PLAYERS; i++) {
+        lobbyUpdate.players[i] = makePlayer(int(i), 0.0);
+    }
+
+    // Decoded values are summed so the reads cannot be optimized away
+    double sink = 0.0;
+    BenchCase cases[] = {
+        {"input batch", sizeof(InputBatchPacket),
+         [&](WireWriter& out) { writeInputBatch(out, batch); },
+         [&](uint8_t type, WireReader& in) {
+             InputBatchPacket message;
+             bool ok = type == PLAYER_INPUT && readInputBatch(in, message);
+             sink += message.inputs[0].sequence;
+             return ok;
+         }},
+        {"snapshot full", MAX_SNAPSHOT_PLAYERS * sizeof(PositionPacket),
+         [&](WireWriter& out) { writeSnapshot(out, snapshot, nullptr); },
+         [&](uint8_t type, WireReader& in) {
+             NetSnapshot message;
+             bool ok = type == SNAPSHOT && readSnapshot(in, history, message);
+             sink += message.players[0].posX;
+             return ok;
+         }},
+        {"snapshot delta", MAX_SNAPSHOT_PLAYERS * sizeof(PositionPacket),
+         [&](WireWriter& out) { writeSnapshot(out, snapshot, &baseline); },
+         [&](uint8_t type, WireReader& in) {
+             NetSnapshot message;
+             bool ok = type == SNAPSHOT && readSnapshot(in, history, message);
+             sink += message.players[0].posX;
+             return ok;
+         }},
+        {"position", sizeof(PositionPacket),
+         [&](WireWriter& out) {
+             PositionPacket position;
+             position.playerID = 1;
+             position.state = lobbyUpdate.players[1];
+             position.lastInput = TICK;
+             writePosition(out, position);
+         },
+         [&](uint8_t type, WireReader& in) {
+             PositionPacket message;
+             bool ok = type == PLAYER_POSITION && readPosition(in, message);
+             sink += message.state.posX;
+             return ok;
+         }},
+        {"lobby update", sizeof(LobbyUpdatePacket),
+         [&](WireWriter& out) { writeLobbyUpdate(out, lobbyUpdate); },
+         [&](uint8_t type, WireReader& in) {
+             LobbyUpdatePacket message;
+             bool ok = type == LOBBY_UPDATE && readLobbyUpdate(in, message);
+             sink += message.numPlayers;
+             return ok;
+         }},
+    };
+
+    std::cout << "Messages: " << iterations << " of each" << std::endl;
+    std::cout << std::left << std::setw(16) << "message" << std::right << std::setw(10) << "raw B"
+              << std::setw(10) << "wire B" << std::setw(12) << "write ns" << std::setw(12)
+              << "read ns" << std::endl;
+
+    for (const BenchCase& bench : cases) {
+        WireWriter out;
+
+        Clock::time_point start = Clock::now();
+        for (long i = 0; i < iterations; i++) {
+            out.clear();
+            bench.write(out);
+        }
+        double writeNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        // Decode through the same iterator the receivers use
+        const std::vector<uint8_t>& bytes = out.bytes();
+        start = Clock::now();
+        for (long i = 0; i < iterations; i++) {
+            MessageIterator messages(bytes.data(), bytes.size());
+            uint8_t type;
+            WireReader payload;
+            if (!messages.next(type, payload) || !bench.read(type, payload)) {
+                std::cerr << "Failed to decode " << bench.name << std::endl;
+                return 1;
+            }
+        }
+        double readNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        std::cout << std::left << std::setw(16) << bench.name << std::right << std::setw(10)
+                  << bench.rawSize << std::setw(10) << bytes.size() << std::fixed
+                  << std::setprecision(1) << std::setw(12) << writeNs / iterations
+                  << std::setw(12) << readNs / iterations << std::endl;
+    }
+
+    // Never true; keeps the decoded values live
+    if (sink == 1.0) {
+        std::cout << sink << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Standalone benchmark for the wall ray kernels in RayKernel.cpp.
+// Casts the same camera poses through every kernel the CPU supports, reports
+// rays/sec and checks the SIMD results against the scalar reference. Exits
+// with status 1 when a kernel is outside its tolerance: where it stopped in
+// the same cell as scalar the results must be identical, and it may only pick
+// the other cell of a corner the ray grazes, on a tiny fraction of columns.
+#include "Map.h"
+#include "RayKernel.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+const int SCREEN_WIDTH = 1024;
+const int TEX_WIDTH = 64;
+const double PLANE_LENGTH = 0.66;
+const double MAX_CELL_DIFF_FRACTION = 1e-5; // Of all columns cast
+const double MAX_CORNER_DIST_ERR = 1e-6;    // Relative, on those columns
+
+// Random poses in empty cells, seeded so every run uses the same set
+std::vector<RayCamera> makeCameraPoses(int count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> coord(1.0, MAP_WIDTH - 1.0);
+    std::uniform_real_distribution<double> angle(0.0, 2.0 * M_PI);
+
+    std::vector<RayCamera> poses;
+    while ((int)poses.size() < count) {
+        double x = coord(gen);
+        double y = coord(gen);
+        if (worldMap[int(x)][int(y)] > 0)
+            continue;
+
+        double a = angle(gen);
+        RayCamera camera;
+        camera.posX = x;
+        camera.posY = y;
+        camera.dirX = cos(a);
+        camera.dirY = sin(a);
+        camera.planeX = camera.dirY * PLANE_LENGTH;
+        camera.planeY = -camera.dirX * PLANE_LENGTH;
+        poses.push_back(camera);
+    }
+    return poses;
+}
+
+int main(int argc, char** argv) {
+    int numPoses = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int repeats = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    std::vector<RayCamera> poses = makeCameraPoses(numPoses);
+
+    // Scalar results for every pose, used to validate the SIMD kernels
+    std::vector<RayHits> reference(poses.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        reference[i].resize(SCREEN_WIDTH);
+        castRays(RAY_KERNEL_SCALAR, poses[i], SCREEN_WIDTH, 0, SCREEN_WIDTH, TEX_WIDTH, reference[i]);
+    }
+
+    std::cout << numPoses << " poses x " << SCREEN_WIDTH << " columns, best of " << repeats
+              << " runs" << std::endl;
+    std::cout << std::left << std::setw(8) << "kernel" << std::right << std::setw(12) << "ms/frame"
+              << std::setw(14) << "Mrays/s" << std::setw(12) << "cell diff" << std::setw(12)
+              << "texX diff" << std::setw(14) << "max dist err" << std::endl;
+
+    const RayKernelType kernels[] = {RAY_KERNEL_SCALAR, RAY_KERNEL_SSE2, RAY_KERNEL_AVX2};
+    bool withinTolerance = true;
+    for (RayKernelType kernel : kernels) {
+        if (!rayKernelSupported(kernel)) {
+            std::cout << std::left << std::setw(8) << rayKernelName(kernel) << "  (not supported)"
+                      << std::endl;
+            continue;
+        }
+
+        RayHits hits;
+        hits.resize(SCREEN_WIDTH);
+
+        double best = 1e30;
+        for (int r = 0; r < repeats; r++) {
+            auto start = std::chrono::steady_clock::now();
+            for (const RayCamera& camera : poses) {
+                castRays(kernel, camera, SCREEN_WIDTH, 0, SCREEN_WIDTH, TEX_WIDTH, hits);
+            }
+            auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(end - start).count());
+        }
+
+        // Compare against the scalar path on the same poses
+        long cellDiff = 0, texDiff = 0;
+        double maxDistErr = 0.0;
+        for (size_t i = 0; i < poses.size(); i++) {
+            castRays(kernel, poses[i], SCREEN_WIDTH, 0, SCREEN_WIDTH, TEX_WIDTH, hits);
+            const RayHits& ref = reference[i];
+            for (int x = 0; x < SCREEN_WIDTH; x++) {
+                double err = std::abs(hits.perpWallDist[x] - ref.perpWallDist[x]) / ref.perpWallDist[x];
+                if (hits.mapX[x] != ref.mapX[x] || hits.mapY[x] != ref.mapY[x] ||
+                    hits.side[x] != ref.side[x]) {
+                    cellDiff++;
+                    if (err > MAX_CORNER_DIST_ERR)
+                        withinTolerance = false;
+                    continue;
+                }
+                if (hits.texX[x] != ref.texX[x] || err != 0.0)
+                    withinTolerance = false;
+                if (hits.texX[x] != ref.texX[x])
+                    texDiff++;
+                maxDistErr = std::max(maxDistErr, err);
+            }
+        }
+
+        double rays = double(poses.size()) * SCREEN_WIDTH;
+        if (cellDiff > rays * MAX_CELL_DIFF_FRACTION)
+            withinTolerance = false;
+        std::cout << std::left << std::setw(8) << rayKernelName(kernel) << std::right << std::fixed
+                  << std::setprecision(4) << std::setw(12) << best * 1000.0 / poses.size()
+                  << std::setprecision(1) << std::setw(14) << rays / best / 1e6 << std::setw(12)
+                  << cellDiff << std::setw(12) << texDiff << std::scientific << std::setprecision(2)
+                  << std::setw(14) << maxDistErr << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
+
+    if (!withinTolerance) {
+        std::cout << "A kernel is outside its tolerance of the scalar path" << std::endl;
+        return 1;
+    }
+    return 0;
+}
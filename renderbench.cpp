@@ -0,0 +1,359 @@
+// Headless benchmark for the software renderer. Draws the 3D view the client
+// draws each frame (textured floor, walls and player sprites) into an
+// offscreen framebuffer along scripted camera paths, with a fixed set of
+// sprites, and reports frame time percentiles, throughput and a checksum of
+// every frame so optimizations can be shown to be pixel-identical.
+#include "Framebuffer.h"
+#include "Profiler.h"
+#include "Raycaster.h"
+#include "SpriteSheet.h"
+#include "TextureStore.h"
+#include "ThreadPool.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+const double PLANE_LENGTH = 0.66;
+const int WARMUP_FRAMES = 10;
+
+// Same wall-to-floor mapping as the client
+const int FLOOR_TEXTURE = 2;
+const int CEILING_TEXTURE = 0;
+
+// Camera keyframe, the angle is in degrees with 0 looking along +x
+struct Keyframe {
+    double x, y, angle;
+};
+
+struct CameraPath {
+    const char* name;
+    std::vector<Keyframe> keys; // Visited in order at constant speed
+};
+
+// Paths stay inside empty cells of worldMap, main() checks every sampled pose
+std::vector<CameraPath> makeCameraPaths() {
+    std::vector<CameraPath> paths;
+
+    // Lap of the outer corridor, looking where we walk. The wall at
+    // worldMap[1][6] blocks the last side, so the lap ends with a dogleg
+    // through x = 5.
+    paths.push_back({"corridor",
+                     {{5.5, 1.5, 0},
+                      {22.5, 1.5, 0},
+                      {22.5, 1.5, 90},
+                      {22.5, 22.5, 90},
+                      {22.5, 22.5, 180},
+                      {1.5, 22.5, 180},
+                      {1.5, 22.5, 270},
+                      {1.5, 7.5, 270},
+                      {1.5, 7.5, 360},
+                      {5.5, 7.5, 360},
+                      {5.5, 7.5, 270},
+                      {5.5, 1.5, 270}}});
+
+    // Full turn in the open middle of the map
+    paths.push_back({"spin", {{14.5, 12.5, 0}, {14.5, 12.5, 360}}});
+
+    // Strafe down an open row looking across the map, long view distances
+    paths.push_back({"strafe", {{14.5, 1.5, 180}, {14.5, 22.5, 180}, {9.5, 22.5, 0}, {9.5, 1.5, 0}}});
+
+    return paths;
+}
+
+// Fixed sprite positions off the camera paths, each with its own frame of
+// the sheet
+struct SpritePlacement {
+    double x, y;
+    int row, col;
+    bool flip;
+};
+
+const SpritePlacement SPRITES[] = {
+    {8.5, 5.5, 0, 2, false},   {13.5, 9.5, 1, 2, true},  {6.5, 16.5, 2, 2, false},
+    {20.5, 12.5, 3, 2, true},  {3.5, 12.5, 0, 0, false}, {20.5, 8.5, 4, 2, true},
+    {12.5, 20.5, 0, 4, false}, {15.5, 14.5, 2, 6, false},
+};
+
+// Path time of a frame, warmup frames (negative) replay the first pose
+double frameTime(int frame, int frames) {
+    return frames > 1 ? std::max(0, frame) / double(frames - 1) : 0.0;
+}
+
+// Pose at time t in [0, 1] along the path
+PlayerState cameraAt(const CameraPath& path, double t) {
+    // Segment lengths, a pure turn counts as one cell per 90 degrees
+    std::vector<double> lengths;
+    double total = 0.0;
+    for (size_t i = 1; i < path.keys.size(); i++) {
+        const Keyframe& a = path.keys[i - 1];
+        const Keyframe& b = path.keys[i];
+        double length = std::hypot(b.x - a.x, b.y - a.y) + std::fabs(b.angle - a.angle) / 90.0;
+        lengths.push_back(length);
+        total += length;
+    }
+
+    Keyframe key = path.keys.back();
+    double distance = t * total;
+    for (size_t i = 0; i < lengths.size(); i++) {
+        if (distance <= lengths[i] && lengths[i] > 0.0) {
+            const Keyframe& a = path.keys[i];
+            const Keyframe& b = path.keys[i + 1];
+            double f = distance / lengths[i];
+            key.x = a.x + (b.x - a.x) * f;
+            key.y = a.y + (b.y - a.y) * f;
+            key.angle = a.angle + (b.angle - a.angle) * f;
+            break;
+        }
+        distance -= lengths[i];
+    }
+
+    double radians = key.angle * M_PI / 180.0;
+    PlayerState camera;
+    camera.posX = key.x;
+    camera.posY = key.y;
+    camera.dirX = cos(radians);
+    camera.dirY = sin(radians);
+    camera.planeX = camera.dirY * PLANE_LENGTH;
+    camera.planeY = -camera.dirX * PLANE_LENGTH;
+    return camera;
+}
+
+// True if every pose sampled along the path stands in an empty map cell
+bool pathInEmptyCells(const CameraPath& path, int frames) {
+    for (int f = 0; f < frames; f++) {
+        PlayerState camera = cameraAt(path, frameTime(f, frames));
+        int mapX = (int)camera.posX;
+        int mapY = (int)camera.posY;
+        if (mapX < 0 || mapX >= MAP_WIDTH || mapY < 0 || mapY >= MAP_HEIGHT ||
+            worldMap[mapX][mapY] != 0) {
+            std::cerr << "Camera path " << path.name << " enters cell (" << mapX << ", " << mapY
+                      << ") at frame " << f << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// FNV-1a over the pixels, chained across frames
+Uint64 hashPixels(Uint64 hash, const std::vector<Uint32>& pixels, int count) {
+    const Uint8* bytes = (const Uint8*)pixels.data();
+    for (size_t i = 0; i < (size_t)count * sizeof(Uint32); i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void writePPM(const std::string& file, const Framebuffer& fb) {
+    FILE* out = fopen(file.c_str(), "wb");
+    if (!out) {
+        throw std::runtime_error("Failed to open " + file);
+    }
+    fprintf(out, "P6\n%d %d\n255\n", fb.width, fb.height);
+    for (int i = 0; i < fb.width * fb.height; i++) {
+        Uint32 p = fb.pixels[i];
+        Uint8 rgb[3] = {(Uint8)(p >> 16), (Uint8)(p >> 8), (Uint8)p};
+        fwrite(rgb, 1, 3, out);
+    }
+    fclose(out);
+}
+
+double percentile(std::vector<double> values, double p) {
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, (size_t)(p * (values.size() - 1) + 0.5));
+    return values[index];
+}
+
+TextureStore loadWallTextures() {
+    TextureStore store;
+    int numTextures = 0;
+    for (int x = 0; x < MAP_WIDTH; x++) {
+        for (int y = 0; y < MAP_HEIGHT; y++) {
+            numTextures = std::max(numTextures, worldMap[x][y]);
+        }
+    }
+    for (int i = 1; i <= numTextures; i++) {
+        std::string file = "wall" + std::to_string(i) + ".png";
+        SDL_Surface* surface = IMG_Load(file.c_str());
+        if (!surface) {
+            throw std::runtime_error("Failed to load " + file + ": " + IMG_GetError());
+        }
+        store.add(loadPixelImage(surface));
+        SDL_FreeSurface(surface);
+    }
+    return store;
+}
+
+bool parseKernel(const std::string& name, RayKernelType& kernel) {
+    const RayKernelType kernels[] = {RAY_KERNEL_SCALAR, RAY_KERNEL_SSE2, RAY_KERNEL_AVX2};
+    for (RayKernelType k : kernels) {
+        if (name == rayKernelName(k)) {
+            kernel = k;
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    int width = SCREEN_WIDTH;
+    int height = SCREEN_HEIGHT;
+    int frames = 600;
+    int threads = 0;
+    bool floors = true;
+    RayKernelType kernel = RAY_KERNEL_SCALAR;
+    bool forceKernel = false; // Otherwise walls and floors each get their best
+    std::string dumpPrefix;
+    std::string traceFile;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc &&
+            sscanf(argv[i + 1], "%dx%d", &width, &height) == 2) {
+            i++;
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--kernel") == 0 && i + 1 < argc &&
+                   parseKernel(argv[i + 1], kernel)) {
+            forceKernel = true;
+            i++;
+        } else if (strcmp(argv[i], "--no-floor") == 0) {
+            floors = false;
+        } else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+            dumpPrefix = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceFile = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--size WxH] [--frames N] [--threads N] [--kernel scalar|sse2|avx2]"
+                         " [--no-floor] [--dump PREFIX] [--trace FILE]"
+                      << std::endl;
+            return -1;
+        }
+    }
+
+    for (const CameraPath& path : makeCameraPaths()) {
+        if (!pathInEmptyCells(path, frames)) {
+            return -1;
+        }
+    }
+
+    // A software renderer on a scratch surface stands in for the window, the
+    // sprite loader needs one to create its texture
+    SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(0, 1, 1, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Renderer* renderer = target ? SDL_CreateSoftwareRenderer(target) : nullptr;
+    if (!renderer) {
+        std::cerr << "Failed to create software renderer: " << SDL_GetError() << std::endl;
+        return -1;
+    }
+
+    SpriteSheet sheet;
+    TextureStore wallTextures;
+    try {
+        sheet = loadSpriteSheet(renderer, "msgunner.info", "msgunner.bmp");
+        wallTextures = loadWallTextures();
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+
+    std::vector<Sprite> sprites;
+    for (const SpritePlacement& placement : SPRITES) {
+        Sprite sprite(placement.x, placement.y, 0.0, &sheet, (int)sprites.size());
+        sprite.frame = sheet.frames[placement.row * sheet.cols + placement.col];
+        sprite.flip = placement.flip;
+        sprites.push_back(sprite);
+    }
+
+    profilerSetThreadName("main");
+    ThreadPool pool(threads);
+    Raycaster raycaster(width, height);
+    if (forceKernel) {
+        raycaster.setRayKernel(kernel);
+    }
+    raycaster.setThreadPool(&pool);
+    raycaster.setWallTextures(wallTextures);
+    if (floors) {
+        raycaster.setFloorTextures(FLOOR_TEXTURE, CEILING_TEXTURE);
+    }
+
+    Framebuffer fb;
+    fb.width = fb.maxWidth = width;
+    fb.height = fb.maxHeight = height;
+    fb.pixels.assign(width * height, 0xFF000000);
+
+    std::cout << width << "x" << height << ", " << frames << " frames per path, "
+              << rayKernelName(raycaster.wallKernelType()) << " walls, "
+              << rayKernelName(raycaster.floorKernelType()) << " floors, " << pool.size()
+              << " thread(s)"
+              << (floors ? "" : ", no floor") << std::endl;
+    std::cout << std::left << std::setw(10) << "path" << std::right << std::setw(9) << "p50 ms"
+              << std::setw(9) << "p95 ms" << std::setw(9) << "p99 ms" << std::setw(10) << "Mrays/s"
+              << std::setw(12) << "Mtexels/s" << std::setw(20) << "checksum" << std::endl;
+
+    Uint64 total = 14695981039346656037ULL;
+    for (const CameraPath& path : makeCameraPaths()) {
+        std::vector<double> frameMs;
+        double seconds = 0.0;
+        long rays = 0, texels = 0;
+        Uint64 checksum = 14695981039346656037ULL;
+
+        for (int f = -WARMUP_FRAMES; f < frames; f++) {
+            PlayerState camera = cameraAt(path, frameTime(f, frames));
+
+            auto start = std::chrono::steady_clock::now();
+            raycaster.drawWalls(camera, fb);
+            raycaster.drawSprites(camera, sprites, fb);
+            auto end = std::chrono::steady_clock::now();
+            if (f < 0) {
+                continue;
+            }
+
+            double elapsed = std::chrono::duration<double>(end - start).count();
+            frameMs.push_back(elapsed * 1000.0);
+            seconds += elapsed;
+
+            const RaycasterStats& stats = raycaster.stats();
+            rays += stats.rays;
+            texels += stats.wallTexels + stats.floorTexels + stats.spriteTexels;
+            checksum = hashPixels(checksum, fb.pixels, width * height);
+        }
+        total = (total ^ checksum) * 1099511628211ULL;
+
+        std::cout << std::left << std::setw(10) << path.name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(9) << percentile(frameMs, 0.50)
+                  << std::setw(9) << percentile(frameMs, 0.95) << std::setw(9)
+                  << percentile(frameMs, 0.99) << std::setprecision(1) << std::setw(10)
+                  << rays / seconds / 1e6 << std::setw(12) << texels / seconds / 1e6 << "    "
+                  << std::hex << std::setfill('0') << std::setw(16) << checksum << std::dec
+                  << std::setfill(' ') << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+
+        if (!dumpPrefix.empty()) {
+            writePPM(dumpPrefix + "-" + path.name + ".ppm", fb);
+        }
+    }
+
+    if (!traceFile.empty() && !profilerWriteTrace(traceFile)) {
+        std::cerr << "Failed to write " << traceFile << std::endl;
+    }
+
+    std::cout << "image checksum " << std::hex << std::setfill('0') << std::setw(16) << total
+              << std::dec << std::endl;
+
+    SDL_DestroyTexture(sheet.texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(target);
+    return 0;
+}
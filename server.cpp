@@ -1,290 +1,259 @@
+#include "Movement.h"
+#include "Protocol.h"
+#include "SnapshotCodec.h"
+#include "SpscQueue.h"
+#include "Visibility.h"
 #include "common.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
 #include <enet/enet.h>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <thread>
+#include <unordered_map>
 #include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
-const int MAX_CLIENTS = 2;
 const int PORT = 1234;
-PlayerState p1;
-PlayerState p2;
+// Each match is a 1v1; one process hosts many of them on the same port.
+// ENet allows at most 4095 peers per host.
+const size_t PLAYERS_PER_MATCH = 2;
+const int DEFAULT_MAX_MATCHES = 256;
+const int MAX_MATCHES = 4095 / PLAYERS_PER_MATCH;
+// Matches are spread over worker threads, the shards. The main thread only
+// does ENet I/O and talks to each shard through a pair of lock-free queues.
+const int MAX_SHARDS = 256;
+const size_t SHARD_QUEUE_CAPACITY = 8192;
+// How long the I/O thread sleeps in enet_host_service when idle; packets
+// from the shards wait at most this before being sent
+const enet_uint32 SERVICE_TIMEOUT_MS = 1;
+const int MIN_TICK_RATE = 10;
+const int MAX_TICK_RATE = 250;
+// A client samples one input per tick, and one is applied per tick. Each
+// tick on which a player had no input earns them one catch-up input, up to
+// MAX_CATCH_UP_INPUTS, so inputs delayed by jitter or recovered from a later
+// batch after loss can still be applied, a few at a time. A client sending
+// inputs faster than the tick rate earns none and moves no faster.
+const size_t MAX_INPUTS_PER_TICK = 3;
+const size_t MAX_CATCH_UP_INPUTS = 8;
+const int MAX_CATCH_UP_TICKS = 5;
+// Interest management: clients are only told about players they can see.
+// Those further than NEAR_DISTANCE cells are updated at a lower rate, and
+// beyond MAX_VIEW_DISTANCE they are not sent at all.
+const double NEAR_DISTANCE = 8.0;
+const double MAX_VIEW_DISTANCE = 16.0;
+const double SIGHT_GRACE_SECONDS = 0.25; // Still sent after going out of sight
+
+// Where players start, by slot in their match. The first player is the
+// match admin.
+struct SpawnPoint {
+  double posX, posY;
+  double dirX, dirY;
+};
+const SpawnPoint SPAWN_POINTS[PLAYERS_PER_MATCH] = {{10.0, 7.0, -1.0, 0.0},
+                                                    {20.0, 14.0, 1.0, 0.0}};
 
-class GameServer {
+// Where a match sends its packets. Connections are numbered by the I/O
+// thread; 0 is never used.
+class PacketSink {
+public:
+  virtual ~PacketSink() {}
+  // Send the messages written to out as one packet
+  virtual void send(uint32_t connection, enet_uint8 channel,
+                    const WireWriter &out, enet_uint32 flags) = 0;
+};
+
+// One game: its players, simulation, lobby and snapshots. Players are
+// numbered by their slot in the match, which is the ID their client sees.
+// Slots are not reused, and the match ends once none of its players are
+// still connected.
+class Match {
 private:
-  ENetHost *server;
-  std::vector<ENetPeer *> clients;
+  uint32_t matchId;
+  PacketSink &sink;
+  std::vector<uint32_t> clients; // Connection per slot, 0 once disconnected
   std::vector<PlayerState> players;
-  const double PLAYER_RADIUS = 0.2; // Collision radius for players
-  const double WALL_BUFFER = 0.1;   // Extra buffer space from walls
+  // Sequence number of the last input applied for each player, echoed back
+  // in position packets so clients can reconcile their prediction
+  std::vector<uint32_t> lastInputSequence;
+
+  // The world is simulated in fixed steps. Inputs are queued as they arrive
+  // and applied on the next tick, one tick of movement each, and every tick
+  // ends with a single snapshot to all clients.
+  int tickRate;
+  double tickDt;
+  uint32_t tickCount = 0;
+  std::vector<std::deque<InputPacket>> inputQueues;
+  std::vector<uint32_t> lastQueuedSequence;
+  std::vector<size_t> catchUpInputs; // Earned on ticks without input
+
+  // Each client gets its own snapshot with just the players it is
+  // interested in, delta-encoded against the newest one it has acknowledged
+  std::vector<SnapshotRing> sentSnapshots;
+  std::vector<uint32_t> ackedTick; // 0 = nothing acknowledged, send in full
+  // lastSeenTick[viewer][target] is the last tick viewer could see target
+  std::vector<std::vector<uint32_t>> lastSeenTick;
+
+  enum Interest { INTEREST_NONE, INTEREST_LOW, INTEREST_FULL };
+
+  // Messages for each client are collected during a tick and sent at its
+  // end as one packet per channel, rather than one packet per message
+  struct OutgoingMessages {
+    WireWriter reliable;
+    WireWriter movement;
+  };
+  std::vector<OutgoingMessages> outgoing;
 
-  double lastTime;
+  void updatePlayerState(size_t playerIndex, const InputPacket &input) {
+    // Inputs that arrive late or twice must not move the player again
+    if (input.sequence <= lastInputSequence[playerIndex])
+      return;
+    lastInputSequence[playerIndex] = input.sequence;
 
-  bool checkCollision(double x, double y, size_t currentPlayerIndex) {
-    // Check map boundaries
-    if (x < 0 || x >= MAP_WIDTH || y < 0 || y >= MAP_HEIGHT) {
-      return true;
-    }
+    // Same code and step as the client's prediction, so a player who
+    // collides with nothing ends up exactly where their client predicted
+    applyInput(players, playerIndex, input, tickDt);
+  }
 
-    // Check the 4 cells around the player's position (including buffer)
-    int minX = static_cast<int>(x - PLAYER_RADIUS - WALL_BUFFER);
-    int maxX = static_cast<int>(x + PLAYER_RADIUS + WALL_BUFFER);
-    int minY = static_cast<int>(y - PLAYER_RADIUS - WALL_BUFFER);
-    int maxY = static_cast<int>(y + PLAYER_RADIUS + WALL_BUFFER);
-
-    // Clamp to map boundaries
-    minX = std::max(0, minX);
-    maxX = std::min(MAP_WIDTH - 1, maxX);
-    minY = std::max(0, minY);
-    maxY = std::min(MAP_HEIGHT - 1, maxY);
-
-    // Check each cell in the area
-    for (int checkX = minX; checkX <= maxX; checkX++) {
-      for (int checkY = minY; checkY <= maxY; checkY++) {
-        if (worldMap[checkX][checkY] > 0) { // If there's a wall
-          // Calculate detailed collision with wall boundaries
-          double wallMinX = checkX;
-          double wallMaxX = checkX + 1.0;
-          double wallMinY = checkY;
-          double wallMaxY = checkY + 1.0;
-
-          // Check if player's collision circle intersects with wall square
-          double closestX = std::max(wallMinX, std::min(wallMaxX, x));
-          double closestY = std::max(wallMinY, std::min(wallMaxY, y));
-
-          double distanceX = x - closestX;
-          double distanceY = y - closestY;
-          double distanceSquared =
-              (distanceX * distanceX) + (distanceY * distanceY);
-
-          if (distanceSquared <
-              (PLAYER_RADIUS + WALL_BUFFER) * (PLAYER_RADIUS + WALL_BUFFER)) {
-            return true; // Collision detected
-          }
-        }
-      }
+  // Each input arrives several times; only the first copy is queued
+  void queueInput(size_t playerIndex, const InputPacket &input) {
+    if (input.sequence <= lastQueuedSequence[playerIndex])
+      return;
+    lastQueuedSequence[playerIndex] = input.sequence;
+
+    // Only inputs the player can still apply are kept: this tick's one and
+    // their catch-up inputs. Older ones are dropped.
+    std::deque<InputPacket> &queue = inputQueues[playerIndex];
+    queue.push_back(input);
+    while (queue.size() > 1 + catchUpInputs[playerIndex]) {
+      queue.pop_front();
     }
+  }
 
-    // Check collision with other players
-    for (size_t i = 0; i < players.size(); i++) {
-      // Skip checking collision with self
-      if (i == currentPlayerIndex)
-        continue;
-
-      const PlayerState &otherPlayer = players[i];
+  // A target is in sight if a line from the viewer reaches its centre or
+  // either side of it
+  bool hasLineOfSight(const PlayerState &viewer, const PlayerState &target) {
+    double dx = target.posX - viewer.posX;
+    double dy = target.posY - viewer.posY;
+    double distance = sqrt(dx * dx + dy * dy);
+    if (distance < 1e-6)
+      return true;
 
-      // Quick AABB check first for performance
-      if (std::abs(otherPlayer.posX - x) < PLAYER_RADIUS * 2 &&
-          std::abs(otherPlayer.posY - y) < PLAYER_RADIUS * 2) {
+    double sideX = -dy / distance * PLAYER_RADIUS;
+    double sideY = dx / distance * PLAYER_RADIUS;
+    return isLineClear(viewer.posX, viewer.posY, target.posX, target.posY) ||
+           isLineClear(viewer.posX, viewer.posY, target.posX + sideX,
+                       target.posY + sideY) ||
+           isLineClear(viewer.posX, viewer.posY, target.posX - sideX,
+                       target.posY - sideY);
+  }
 
-        // More precise circle collision check
-        double dx = otherPlayer.posX - x;
-        double dy = otherPlayer.posY - y;
-        double distanceSquared = dx * dx + dy * dy;
+  // How often viewer should be told about target. Players stay relevant for
+  // a moment after going behind a wall, so one peeking around a corner does
+  // not flicker in and out.
+  Interest interestIn(size_t viewer, size_t target) {
+    if (viewer == target)
+      return INTEREST_FULL;
+    if (!clients[target])
+      return INTEREST_NONE;
+
+    const PlayerState &from = players[viewer];
+    const PlayerState &to = players[target];
+    double dx = to.posX - from.posX;
+    double dy = to.posY - from.posY;
+    double distance = sqrt(dx * dx + dy * dy);
 
-        if (distanceSquared < (PLAYER_RADIUS * 2) * (PLAYER_RADIUS * 2)) {
-          return true; // Player collision detected
-        }
-      }
+    uint32_t &lastSeen = lastSeenTick[viewer][target];
+    if (distance <= MAX_VIEW_DISTANCE && hasLineOfSight(from, to)) {
+      lastSeen = tickCount;
+    } else if (lastSeen == 0 ||
+               (tickCount - lastSeen) * tickDt > SIGHT_GRACE_SECONDS) {
+      return INTEREST_NONE;
     }
-
-    return false; // No collision
+    return distance > NEAR_DISTANCE ? INTEREST_LOW : INTEREST_FULL;
   }
 
-  void updatePlayerState(size_t playerIndex, const InputPacket &input) {
-    PlayerState &player = players[playerIndex];
-    double prevX = player.posX;
-    double prevY = player.posY;
-
-    // Calculate delta time in seconds
-    double currentTime = enet_time_get() / 1000.0;
-    double deltaTime = currentTime - lastTime;
-    lastTime = currentTime;
-
-    const double BASE_MOVE_SPEED = 6.0;
-    const double BASE_ROT_SPEED = 3.0;
-
-    const double moveSpeed = BASE_MOVE_SPEED * deltaTime;
-    const double rotSpeed = BASE_ROT_SPEED * deltaTime;
-
-    // Store original position for collision resolution
-    double newX = player.posX;
-    double newY = player.posY;
-
-    if (input.mouseRotation != 0.0) {
-      double rotAmount =
-          -input.mouseRotation; // Negative because screen coordinates
-      double oldDirX = player.dirX;
-      player.dirX = player.dirX * cos(rotAmount) - player.dirY * sin(rotAmount);
-      player.dirY = oldDirX * sin(rotAmount) + player.dirY * cos(rotAmount);
-      double oldPlaneX = player.planeX;
-      player.planeX =
-          player.planeX * cos(rotAmount) - player.planeY * sin(rotAmount);
-      player.planeY =
-          oldPlaneX * sin(rotAmount) + player.planeY * cos(rotAmount);
-    }
-
-    if (input.turnRight) {
-      double oldDirX = player.dirX;
-      player.dirX = player.dirX * cos(-rotSpeed) - player.dirY * sin(-rotSpeed);
-      player.dirY = oldDirX * sin(-rotSpeed) + player.dirY * cos(-rotSpeed);
-      double oldPlaneX = player.planeX;
-      player.planeX =
-          player.planeX * cos(-rotSpeed) - player.planeY * sin(-rotSpeed);
-      player.planeY =
-          oldPlaneX * sin(-rotSpeed) + player.planeY * cos(-rotSpeed);
-    }
-    if (input.turnLeft) {
-      double oldDirX = player.dirX;
-      player.dirX = player.dirX * cos(rotSpeed) - player.dirY * sin(rotSpeed);
-      player.dirY = oldDirX * sin(rotSpeed) + player.dirY * cos(rotSpeed);
-      double oldPlaneX = player.planeX;
-      player.planeX =
-          player.planeX * cos(rotSpeed) - player.planeY * sin(rotSpeed);
-      player.planeY = oldPlaneX * sin(rotSpeed) + player.planeY * cos(rotSpeed);
-    }
-
-    // Handle movement with collision detection
-    if (input.forward) {
-      newX = player.posX + player.dirX * moveSpeed;
-      newY = player.posY + player.dirY * moveSpeed;
-    }
-    if (input.backward) {
-      newX = player.posX - player.dirX * moveSpeed;
-      newY = player.posY - player.dirY * moveSpeed;
-    }
-    if (input.strafeRight) {
-      newX = player.posX + player.dirY * moveSpeed;
-      newY = player.posY - player.dirX * moveSpeed;
-    }
-    if (input.strafeLeft) {
-      newX = player.posX - player.dirY * moveSpeed;
-      newY = player.posY + player.dirX * moveSpeed;
-    }
-
-    // Try to move with collision detection
-    // First try the full movement
-    if (!checkCollision(newX, newY, playerIndex)) {
-      player.posX = newX;
-      player.posY = newY;
-    } else {
-      // If collision, try moving along X axis only
-      if (!checkCollision(newX, player.posY, playerIndex)) {
-        player.posX = newX;
-      }
-      // Try moving along Y axis only
-      else if (!checkCollision(player.posX, newY, playerIndex)) {
-        player.posY = newY;
-      }
-      // If both failed, player stays in current position
-    }
-    player.isMoving = (player.posX != prevX || player.posY != prevY);
-  }
+  void broadcastSnapshot() {
+    if (players.empty())
+      return;
 
-public:
-  GameServer() {
-    if (enet_initialize() != 0) {
-      throw std::runtime_error("Failed to initialize ENet");
+    NetSnapshot world;
+    memset(&world, 0, sizeof(world));
+    world.tick = tickCount;
+    world.numPlayers = std::min(players.size(), MAX_SNAPSHOT_PLAYERS);
+    for (size_t i = 0; i < world.numPlayers; i++) {
+      world.players[i] = quantizePlayer(players[i], lastInputSequence[i]);
     }
 
-    lastTime = enet_time_get() / 1000.0;
-
-    ENetAddress address;
-    address.host = ENET_HOST_ANY;
-    address.port = PORT;
+    for (size_t i = 0; i < clients.size(); i++) {
+      if (!clients[i])
+        continue;
 
-    server = enet_host_create(&address, MAX_CLIENTS, 2, 0, 0);
-    if (!server) {
-      throw std::runtime_error("Failed to create ENet server");
-    }
+      // Players this client is not due an update about keep the state it
+      // was last sent, which costs one bit against the baseline. Hidden
+      // ones are flagged so it stops drawing them.
+      const NetSnapshot *previous = sentSnapshots[i].find(tickCount - 1);
+      NetSnapshot view = world;
+      for (size_t j = 0; j < view.numPlayers; j++) {
+        // A player coming back into sight is sent at once, whatever its rate
+        Interest interest = interestIn(i, j);
+        bool wasHidden = previous && j < previous->numPlayers &&
+                         previous->players[j].hidden;
+        if (interest == INTEREST_FULL ||
+            (interest == INTEREST_LOW &&
+             (wasHidden || (tickCount + j) % DISTANT_UPDATE_INTERVAL == 0)))
+          continue;
+
+        NetPlayerState &entry = view.players[j];
+        if (previous && j < previous->numPlayers) {
+          entry = previous->players[j];
+        } else if (interest == INTEREST_NONE) {
+          memset(&entry, 0, sizeof(entry));
+        }
+        entry.hidden = interest == INTEREST_NONE;
+      }
+      sentSnapshots[i].put(view);
 
-    // Initialize starting positions for players
-    PlayerState p1;
-    p1.posX = 10.0;
-    p1.posY = 7.0;
-    // PlayerState p1;
-    // p1.name = "Player 1";
-    p1.isAdmin = true;
-    p1.dirX = -1.0;
-    p1.dirY = 0.0;
-    p1.planeX = 0.0;
-    p1.planeY = 0.66;
-
-    PlayerState p2;
-    p2.posX = 20.0;
-    p2.posY = 14.0;
-    p2.isAdmin = false;
-    p2.dirX = 1.0;
-    p2.dirY = 0.0;
-    p2.planeX = 0.0;
-    p2.planeY = 0.66;
-    // players.push_back(p1);
-    // players.push_back(p2);
-  }
-
-  bool hasWallBetweenPoints(double startX, double startY, double endX,
-                            double endY) {
-    // Implementation of Digital Differential Analyzer (DDA) algorithm
-    double dirX = endX - startX;
-    double dirY = endY - startY;
-    double distance = sqrt(dirX * dirX + dirY * dirY);
-
-    // Normalize direction vector
-    dirX /= distance;
-    dirY /= distance;
-
-    // Starting map cell
-    int mapX = int(startX);
-    int mapY = int(startY);
-
-    // Length of ray from one x or y-side to next x or y-side
-    double deltaDistX = std::abs(1.0 / dirX);
-    double deltaDistY = std::abs(1.0 / dirY);
-
-    // Calculate step and initial sideDist
-    double sideDistX, sideDistY;
-    int stepX, stepY;
-
-    if (dirX < 0) {
-      stepX = -1;
-      sideDistX = (startX - mapX) * deltaDistX;
-    } else {
-      stepX = 1;
-      sideDistX = (mapX + 1.0 - startX) * deltaDistX;
+      writeSnapshot(outgoing[i].movement, view,
+                    sentSnapshots[i].find(ackedTick[i]));
     }
+  }
 
-    if (dirY < 0) {
-      stepY = -1;
-      sideDistY = (startY - mapY) * deltaDistY;
-    } else {
-      stepY = 1;
-      sideDistY = (mapY + 1.0 - startY) * deltaDistY;
-    }
-
-    // Perform DDA
-    double rayLength = 0.0;
-    while (rayLength < distance) {
-      // Jump to next map square
-      if (sideDistX < sideDistY) {
-        rayLength = sideDistX;
-        sideDistX += deltaDistX;
-        mapX += stepX;
-      } else {
-        rayLength = sideDistY;
-        sideDistY += deltaDistY;
-        mapY += stepY;
-      }
-
-      // Check if ray has hit a wall
-      if (mapX < 0 || mapX >= MAP_WIDTH || mapY < 0 || mapY >= MAP_HEIGHT) {
-        return true; // Hit map boundary
+  // Queue messages for every connected client
+  void queueBroadcast(const WireWriter &messages) {
+    for (size_t i = 0; i < clients.size(); i++) {
+      if (clients[i]) {
+        outgoing[i].reliable.writeBytes(messages.bytes().data(),
+                                        messages.bytes().size());
       }
+    }
+  }
 
-      if (worldMap[mapX][mapY] > 0) {
-        return true; // Hit a wall
+  // Send everything queued this tick, one packet per client and channel
+  void flushOutgoing() {
+    for (size_t i = 0; i < clients.size(); i++) {
+      OutgoingMessages &queued = outgoing[i];
+      if (clients[i]) {
+        if (!queued.reliable.empty()) {
+          sink.send(clients[i], RELIABLE_CHANNEL, queued.reliable,
+                    ENET_PACKET_FLAG_RELIABLE);
+        }
+        if (!queued.movement.empty()) {
+          sink.send(clients[i], MOVEMENT_CHANNEL, queued.movement, 0);
+        }
       }
+      queued.reliable.clear();
+      queued.movement.clear();
     }
-
-    return false; // No walls between points
   }
 
   bool isPlayerHit(const PlayerState &shooter, const PlayerState &target) {
@@ -312,6 +281,19 @@ public:
     if (dotProduct <= 0.984)
       return false; // cos(10°) ≈ 0.984
 
+    // Skip the march below if the shooter's cell cannot see any cell the
+    // target's hit tolerance reaches into
+    bool mayBeVisible = false;
+    const double reach = PLAYER_RADIUS * 2;
+    for (int corner = 0; corner < 4 && !mayBeVisible; corner++) {
+      double cornerX = target.posX + (corner & 1 ? reach : -reach);
+      double cornerY = target.posY + (corner & 2 ? reach : -reach);
+      mayBeVisible = cellsMayBeVisible(int(shooter.posX), int(shooter.posY),
+                                       int(cornerX), int(cornerY));
+    }
+    if (!mayBeVisible)
+      return false;
+
     // Now check for walls using a more precise approach
     double currX = shooter.posX;
     double currY = shooter.posY;
@@ -380,139 +362,162 @@ public:
           hitPacket.targetID = i;
 
           // Broadcast hit notification to all clients
-          ENetPacket *packet =
-              enet_packet_create(&hitPacket, sizeof(HitNotificationPacket),
-                                 ENET_PACKET_FLAG_RELIABLE);
-          enet_host_broadcast(server, 0, packet);
+          WireWriter out;
+          writeHitNotification(out, hitPacket);
+          queueBroadcast(out);
 
-          std::cout << "Player " << shotPacket.shooterID << " hit player " << i
+          std::cout << "Match " << matchId << ": player "
+                    << shotPacket.shooterID << " hit player " << i
                     << std::endl;
         }
       }
     }
   }
-  void run() {
-    std::cout << "Server running on port " << PORT << std::endl;
 
-    while (true) {
-      ENetEvent event;
-      while (enet_host_service(server, &event, 10) > 0) {
-        // std::cout << "📩 Received Packet of type: " << event.type <<
-        // std::endl; std::cout << "ENET_EVENT_TYPE_CONNECT: " <<
-        // ENET_EVENT_TYPE_CONNECT << std::endl; std::cout <<
-        // "ENET_EVENT_TYPE_RECEIVE: " << ENET_EVENT_TYPE_RECEIVE << std::endl;
-        // std::cout << "ENET_EVENT_TYPE_DISCONNECT: " <<
-        // ENET_EVENT_TYPE_DISCONNECT << std::endl;
-        switch (event.type) {
-        case ENET_EVENT_TYPE_CONNECT: {
-          std::cout << "Client connected from " << event.peer->address.host
-                    << ":" << event.peer->address.port << std::endl;
-
-          switch (players.size()) {
-          case 0: {
-            players.push_back(p1);
-            // std::cout << "1 player" << std::endl;
-            break;
-          }
-          case 1: {
-            players.push_back(p2);
-            // std::cout << "2 players" << std::endl;
-            break;
-          }
-          }
+public:
+  Match(uint32_t matchId, PacketSink &sink, int tickRate)
+      : matchId(matchId), sink(sink), tickRate(tickRate),
+        tickDt(1.0 / tickRate) {}
+
+  uint32_t id() const { return matchId; }
+  bool isFull() const { return clients.size() >= PLAYERS_PER_MATCH; }
+  bool isEmpty() const {
+    for (uint32_t connection : clients) {
+      if (connection)
+        return false;
+    }
+    return true;
+  }
 
-          // Find first available player slot
-          size_t newPlayerID = clients.size();
-          clients.push_back(event.peer);
-          event.peer->data = (void *)newPlayerID;
-
-          // Send the player their ID
-          uint8_t idPacket = (uint8_t)newPlayerID;
-          ENetPacket *packet = enet_packet_create(&idPacket, sizeof(uint8_t),
-                                                  ENET_PACKET_FLAG_RELIABLE);
-          enet_peer_send(event.peer, 0, packet);
-
-          // Send initial positions of all players to the new client
-          for (size_t i = 0; i < players.size(); i++) {
-            PositionPacket posPacket;
-            posPacket.playerID = i;
-            posPacket.state = players[i];
-
-            std::cout << "Sending PositionPacket - Player ID: "
-                      << (int)posPacket.playerID
-                      << " | X: " << posPacket.state.posX
-                      << " | Y: " << posPacket.state.posY << std::endl;
-
-            packet = enet_packet_create(&posPacket, sizeof(PositionPacket),
-                                        ENET_PACKET_FLAG_RELIABLE);
-
-            if (!packet) {
-              std::cerr << "Error: Failed to create position packet!"
-                        << std::endl;
-              continue;
-            }
-
-            enet_peer_send(event.peer, 0, packet);
-          }
+  // Advance the simulation by one tick and send the result
+  void tick() {
+    for (size_t i = 0; i < players.size() && i < inputQueues.size(); i++) {
+      std::deque<InputPacket> &queue = inputQueues[i];
+      if (queue.empty()) {
+        catchUpInputs[i] = std::min(catchUpInputs[i] + 1, MAX_CATCH_UP_INPUTS);
+        continue;
+      }
+      updatePlayerState(i, queue.front());
+      queue.pop_front();
+      for (size_t n = 1; n < MAX_INPUTS_PER_TICK && !queue.empty() && catchUpInputs[i] > 0;
+           n++) {
+        catchUpInputs[i]--;
+        updatePlayerState(i, queue.front());
+        queue.pop_front();
+      }
+    }
+    tickCount++;
+    broadcastSnapshot();
+    flushOutgoing();
+  }
 
-          break;
-        }
-        case ENET_EVENT_TYPE_RECEIVE: {
-          size_t playerIndex = (size_t)event.peer->data;
-
-          // Check packet size to determine type
-          if (event.packet->dataLength == sizeof(InputPacket)) {
-            // Handle movement input
-            InputPacket *input = (InputPacket *)event.packet->data;
-            updatePlayerState(playerIndex, *input);
-
-            // Broadcast updated positions to all clients
-            for (size_t i = 0; i < players.size(); i++) {
-              PositionPacket posPacket;
-              posPacket.playerID = i;
-              posPacket.state = players[i];
-
-              ENetPacket *packet =
-                  enet_packet_create(&posPacket, sizeof(PositionPacket),
-                                     ENET_PACKET_FLAG_RELIABLE);
-              enet_host_broadcast(server, 0, packet);
-            }
-          } else if (event.packet->dataLength == sizeof(ShotAttemptPacket)) {
-            // Handle shot attempt
-            ShotAttemptPacket *shotPacket =
-                (ShotAttemptPacket *)event.packet->data;
-            handleShot(*shotPacket, players);
-          } else if (event.packet->dataLength == 5 &&
-                     memcmp(event.packet->data, "JOIN", 4) == 0) {
-            // Handle join request
-            broadcastLobbyUpdate();
-          }
+  // Seat a new connection in the next free slot, which must exist, and
+  // return the slot
+  size_t addPeer(uint32_t connection) {
+    size_t newPlayerID = clients.size();
+    const SpawnPoint &spawn = SPAWN_POINTS[newPlayerID];
+    PlayerState player;
+    player.posX = spawn.posX;
+    player.posY = spawn.posY;
+    player.dirX = spawn.dirX;
+    player.dirY = spawn.dirY;
+    player.planeX = spawn.dirY * CAMERA_PLANE_LENGTH;
+    player.planeY = -spawn.dirX * CAMERA_PLANE_LENGTH;
+    player.isAdmin = newPlayerID == 0;
+    players.push_back(player);
+
+    clients.push_back(connection);
+    lastInputSequence.push_back(0);
+    inputQueues.push_back(std::deque<InputPacket>());
+    lastQueuedSequence.push_back(0);
+    catchUpInputs.push_back(0);
+    ackedTick.push_back(0);
+    sentSnapshots.push_back(SnapshotRing());
+    for (std::vector<uint32_t> &row : lastSeenTick) {
+      row.push_back(0);
+    }
+    lastSeenTick.push_back(std::vector<uint32_t>(clients.size(), 0));
 
-          enet_packet_destroy(event.packet);
-          break;
-        }
-        case ENET_EVENT_TYPE_DISCONNECT: {
-          std::cout << "Client disconnected" << std::endl;
-          size_t playerIndex = (size_t)event.peer->data;
-          clients[playerIndex] = nullptr;
-
-          // Reset the disconnected player's position
-          players[playerIndex] = PlayerState();
-
-          // Notify other clients about the disconnection
-          PositionPacket posPacket;
-          posPacket.playerID = playerIndex;
-          posPacket.state = players[playerIndex];
-
-          ENetPacket *packet = enet_packet_create(
-              &posPacket, sizeof(PositionPacket), ENET_PACKET_FLAG_RELIABLE);
-          enet_host_broadcast(server, 0, packet);
-          break;
-        }
-        default:
-          break;
-        }
+    // Send the player their ID and how fast the server ticks, then the
+    // initial positions of all players, with the next tick's packet
+    outgoing.push_back(OutgoingMessages());
+    WireWriter &out = outgoing[newPlayerID].reliable;
+    WelcomePacket welcome;
+    welcome.playerID = (uint8_t)newPlayerID;
+    welcome.tickRate = (uint16_t)tickRate;
+    writeWelcome(out, welcome);
+
+    for (size_t i = 0; i < players.size(); i++) {
+      PositionPacket posPacket;
+      posPacket.playerID = i;
+      posPacket.state = players[i];
+      posPacket.lastInput = lastInputSequence[i];
+      writePosition(out, posPacket);
+    }
+    return newPlayerID;
+  }
+
+  void removePeer(size_t playerIndex) {
+    clients[playerIndex] = 0;
+
+    // Reset the disconnected player's position
+    players[playerIndex] = PlayerState();
+    lastInputSequence[playerIndex] = 0;
+    inputQueues[playerIndex].clear();
+    lastQueuedSequence[playerIndex] = 0;
+    catchUpInputs[playerIndex] = 0;
+    ackedTick[playerIndex] = 0;
+    sentSnapshots[playerIndex].clear();
+    for (size_t i = 0; i < lastSeenTick.size(); i++) {
+      lastSeenTick[i][playerIndex] = 0;
+      lastSeenTick[playerIndex][i] = 0;
+    }
+
+    // Notify other clients about the disconnection
+    PositionPacket posPacket;
+    posPacket.playerID = playerIndex;
+    posPacket.state = players[playerIndex];
+    posPacket.lastInput = 0;
+
+    WireWriter out;
+    writePosition(out, posPacket);
+    queueBroadcast(out);
+  }
+
+  void handleMessage(size_t playerIndex, enet_uint8 channel, uint8_t type,
+                     WireReader &payload) {
+    switch (type) {
+    case PLAYER_INPUT: {
+      // Inputs are only taken from the movement channel, where stale ones
+      // are dropped
+      InputBatchPacket batch;
+      if (channel != MOVEMENT_CHANNEL || !readInputBatch(payload, batch))
+        break;
+
+      // Movement input is applied on the next tick
+      for (size_t i = 0; i < batch.count; i++) {
+        queueInput(playerIndex, batch.inputs[i]);
       }
+      if (batch.ackTick > ackedTick[playerIndex] &&
+          batch.ackTick <= tickCount) {
+        ackedTick[playerIndex] = batch.ackTick;
+      }
+      break;
+    }
+    case SHOT_ATTEMPT: {
+      ShotAttemptPacket shotPacket;
+      if (readShotAttempt(payload, shotPacket)) {
+        handleShot(shotPacket, players);
+      }
+      break;
+    }
+    case JOIN_REQUEST:
+      broadcastLobbyUpdate();
+      break;
+    default:
+      std::cerr << "Ignoring message of unknown type " << (int)type
+                << std::endl;
+      break;
     }
   }
 
@@ -525,7 +530,7 @@ public:
     LobbyUpdatePacket lobbyPacket;
     lobbyPacket.numPlayers = players.size();
 
-    std::cout << "Broadcasting lobby update with "
+    std::cout << "Match " << matchId << ": broadcasting lobby update with "
               << (int)lobbyPacket.numPlayers << " players." << std::endl;
 
     for (size_t i = 0; i < players.size(); i++) {
@@ -533,25 +538,584 @@ public:
           players[i]; // ✅ Now only sending IDs and positions
     }
 
-    ENetPacket *packet = enet_packet_create(
-        &lobbyPacket, sizeof(LobbyUpdatePacket), ENET_PACKET_FLAG_RELIABLE);
+    WireWriter out;
+    writeLobbyUpdate(out, lobbyPacket);
+    queueBroadcast(out);
+  }
+};
+
+// CPUs this process may run on, which taskset or a cgroup cpuset can limit
+// to fewer than the machine has. Only Linux reports them; elsewhere it is
+// every core, and threads are never pinned.
+static std::vector<int> allowedCpus() {
+  std::vector<int> cpus;
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &set))
+        cpus.push_back(cpu);
+    }
+  }
+#endif
+  if (cpus.empty()) {
+    int cores = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int cpu = 0; cpu < cores; cpu++) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+// Pin the calling thread to one CPU, so its matches stay in that core's
+// caches. Only done on Linux; elsewhere threads are left to the scheduler.
+static void pinCurrentThread(int cpu) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+    std::cerr << "Could not pin thread to CPU " << cpu << std::endl;
+  }
+#else
+  (void)cpu;
+#endif
+}
+
+// Something for a shard to handle, from the I/O thread. RECEIVE events own
+// their packet; the shard destroys it.
+struct ShardEvent {
+  ENetEventType type;
+  uint32_t connection;
+  uint32_t matchId;   // CONNECT only: the match to seat the connection in
+  ENetPacket *packet; // RECEIVE only
+  enet_uint8 channel;
+};
+
+// A packet from a shard for the I/O thread to send
+struct OutgoingPacket {
+  uint32_t connection;
+  ENetPacket *packet;
+  enet_uint8 channel;
+};
+
+// A worker thread and the matches it owns. Only that thread touches the
+// matches; everything else goes through the two queues, so nothing mutable
+// is shared between shards or with the I/O thread.
+class Shard : public PacketSink {
+private:
+  int tickRate;
+  double tickDt;
+  int cpu; // -1 = not pinned
+  std::thread thread;
+  std::atomic<bool> running;
+
+  SpscQueue<ShardEvent> inbound;      // I/O thread -> shard
+  SpscQueue<OutgoingPacket> outbound; // Shard -> I/O thread
+  // Events waiting for room in a full queue, each owned by the side that
+  // pushes to that queue
+  std::deque<ShardEvent> inboundBacklog;
+  std::deque<OutgoingPacket> outboundBacklog;
+
+  // Shard thread only
+  std::unordered_map<uint32_t, std::unique_ptr<Match>> matches;
+  struct Seat {
+    Match *match;
+    size_t slot;
+  };
+  std::unordered_map<uint32_t, Seat> seats; // By connection
+
+  // How long ticks take, written by the shard thread and collected by the
+  // I/O thread for the stats log
+  std::atomic<uint64_t> ticksRun;
+  std::atomic<uint64_t> tickNanos;
+  std::atomic<uint64_t> maxTickNanos;
+
+  void handle(const ShardEvent &event) {
+    switch (event.type) {
+    case ENET_EVENT_TYPE_CONNECT: {
+      std::unique_ptr<Match> &match = matches[event.matchId];
+      if (!match) {
+        match.reset(new Match(event.matchId, *this, tickRate));
+      }
+      Seat seat;
+      seat.match = match.get();
+      seat.slot = match->addPeer(event.connection);
+      seats[event.connection] = seat;
+      std::cout << "Match " << event.matchId << ": player " << seat.slot
+                << " joined" << std::endl;
+      break;
+    }
+    case ENET_EVENT_TYPE_RECEIVE: {
+      auto found = seats.find(event.connection);
+      if (found != seats.end()) {
+        MessageIterator messages(event.packet->data,
+                                 event.packet->dataLength);
+        uint8_t type;
+        WireReader payload;
+        while (messages.next(type, payload)) {
+          found->second.match->handleMessage(found->second.slot,
+                                             event.channel, type, payload);
+        }
+      }
+      enet_packet_destroy(event.packet);
+      break;
+    }
+    case ENET_EVENT_TYPE_DISCONNECT: {
+      auto found = seats.find(event.connection);
+      if (found == seats.end())
+        break;
+      Match *match = found->second.match;
+      match->removePeer(found->second.slot);
+      seats.erase(found);
+      if (match->isEmpty()) {
+        std::cout << "Match " << match->id() << " ended" << std::endl;
+        matches.erase(match->id());
+      }
+      break;
+    }
+    default:
+      break;
+    }
+  }
+
+  void threadLoop() {
+    if (cpu >= 0) {
+      pinCurrentThread(cpu);
+    }
+
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration tickInterval =
+        std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(tickDt));
+    Clock::time_point nextTick = Clock::now() + tickInterval;
+
+    // Inputs are only applied on the next tick anyway, so events are
+    // handled in one batch just before it
+    while (running) {
+      std::this_thread::sleep_until(nextTick);
+      Clock::time_point tickStart = Clock::now();
+
+      ShardEvent event;
+      while (inbound.pop(event)) {
+        handle(event);
+      }
+      for (auto &match : matches) {
+        match.second->tick();
+      }
+      while (!outboundBacklog.empty() &&
+             outbound.push(outboundBacklog.front())) {
+        outboundBacklog.pop_front();
+      }
+
+      uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           Clock::now() - tickStart)
+                           .count();
+      ticksRun.fetch_add(1, std::memory_order_relaxed);
+      tickNanos.fetch_add(nanos, std::memory_order_relaxed);
+      // The I/O thread resets the maximum while we raise it
+      uint64_t maxNanos = maxTickNanos.load(std::memory_order_relaxed);
+      while (nanos > maxNanos &&
+             !maxTickNanos.compare_exchange_weak(maxNanos, nanos,
+                                                 std::memory_order_relaxed)) {
+      }
+
+      nextTick += tickInterval;
+      // After a long stall skip the missed ticks rather than running them
+      // back to back
+      Clock::time_point now = Clock::now();
+      if (now - nextTick > tickInterval * MAX_CATCH_UP_TICKS) {
+        nextTick = now + tickInterval;
+      }
+    }
+  }
+
+public:
+  Shard(int tickRate, int cpu)
+      : tickRate(tickRate), tickDt(1.0 / tickRate), cpu(cpu), running(false),
+        inbound(SHARD_QUEUE_CAPACITY), outbound(SHARD_QUEUE_CAPACITY),
+        ticksRun(0), tickNanos(0), maxTickNanos(0) {}
+
+  ~Shard() {
+    running = false;
+    if (thread.joinable()) {
+      thread.join();
+    }
+
+    // Drop whatever neither side got to
+    ShardEvent event;
+    while (inbound.pop(event)) {
+      inboundBacklog.push_back(event);
+    }
+    for (const ShardEvent &pending : inboundBacklog) {
+      if (pending.packet) {
+        enet_packet_destroy(pending.packet);
+      }
+    }
+    OutgoingPacket packet;
+    while (outbound.pop(packet)) {
+      outboundBacklog.push_back(packet);
+    }
+    for (const OutgoingPacket &pending : outboundBacklog) {
+      enet_packet_destroy(pending.packet);
+    }
+  }
+
+  Shard(const Shard &) = delete;
+  Shard &operator=(const Shard &) = delete;
+
+  // The queues are cache-line aligned, which plain new does not honour
+  // before C++17
+  static void *operator new(size_t size) {
+    void *memory;
+    if (posix_memalign(&memory, 64, size) != 0)
+      throw std::bad_alloc();
+    return memory;
+  }
+  static void operator delete(void *memory) { free(memory); }
+
+  void start() {
+    running = true;
+    thread = std::thread(&Shard::threadLoop, this);
+  }
+
+  // I/O thread only. Keeps events in order: once anything is waiting in
+  // the backlog, new events queue up behind it.
+  void post(const ShardEvent &event) {
+    if (!inboundBacklog.empty() || !inbound.push(event)) {
+      inboundBacklog.push_back(event);
+    }
+  }
+
+  // I/O thread only. Moves backlogged events into the queue as it drains,
+  // then returns the next packet to send, if any.
+  bool pollOutgoing(OutgoingPacket &packet) {
+    while (!inboundBacklog.empty() && inbound.push(inboundBacklog.front())) {
+      inboundBacklog.pop_front();
+    }
+    return outbound.pop(packet);
+  }
+
+  // I/O thread only. Ticks run and their total and longest time since
+  // the last call.
+  void takeTickStats(uint64_t &ticks, uint64_t &nanos, uint64_t &maxNanos) {
+    ticks = ticksRun.exchange(0, std::memory_order_relaxed);
+    nanos = tickNanos.exchange(0, std::memory_order_relaxed);
+    maxNanos = maxTickNanos.exchange(0, std::memory_order_relaxed);
+  }
+
+  // Shard thread only, called by its matches
+  void send(uint32_t connection, enet_uint8 channel, const WireWriter &out,
+            enet_uint32 flags) override {
+    ENetPacket *packet =
+        enet_packet_create(out.bytes().data(), out.bytes().size(), flags);
     if (!packet) {
-      std::cerr << "Error: Failed to create lobby update packet!" << std::endl;
+      std::cerr << "Error: Failed to create packet!" << std::endl;
       return;
     }
+    OutgoingPacket outgoingPacket = {connection, packet, channel};
+    if (!outboundBacklog.empty() || !outbound.push(outgoingPacket)) {
+      outboundBacklog.push_back(outgoingPacket);
+    }
+  }
+};
+
+// The I/O front end. Owns the ENet host and routes each peer to a match on
+// one of the shards. New peers join the first match with a free slot, or a
+// new one on the shard running the fewest matches if every match is full.
+class GameServer {
+private:
+  ENetHost *server;
+  int tickRate;
+  size_t maxMatches;
+  double statsInterval; // Seconds between stats lines, 0 = none
+  std::vector<std::unique_ptr<Shard>> shards;
+
+  // The router's own view of the matches, kept apart from the shards'
+  struct MatchInfo {
+    uint32_t id;
+    size_t shard;
+    size_t seated;    // Slots handed out, never reused
+    size_t connected; // The match ends when this reaches 0
+  };
+  std::vector<MatchInfo> matches;
+  std::vector<size_t> matchesPerShard;
+  uint32_t nextMatchId = 1;
+
+  struct PeerRoute {
+    uint32_t connection;
+    uint32_t matchId;
+    size_t shard;
+  };
+  std::unordered_map<ENetPeer *, PeerRoute> routes;
+  std::unordered_map<uint32_t, ENetPeer *> peersByConnection;
+  uint32_t nextConnection = 1;
+
+  MatchInfo *findOpenMatch() {
+    for (MatchInfo &match : matches) {
+      if (match.seated < PLAYERS_PER_MATCH)
+        return &match;
+    }
+    if (matches.size() >= maxMatches)
+      return nullptr;
+
+    size_t shard = 0;
+    for (size_t i = 1; i < shards.size(); i++) {
+      if (matchesPerShard[i] < matchesPerShard[shard]) {
+        shard = i;
+      }
+    }
+    MatchInfo match;
+    match.id = nextMatchId++;
+    match.shard = shard;
+    match.seated = 0;
+    match.connected = 0;
+    matches.push_back(match);
+    matchesPerShard[shard]++;
+    std::cout << "Match " << match.id << " created on shard " << shard << " ("
+              << matches.size() << " running)" << std::endl;
+    return &matches.back();
+  }
 
-    enet_host_broadcast(server, 0, packet);
+  // One line of load figures, for capacity testing: players, tick time
+  // across all shards against the tick budget, and bandwidth out
+  void printStats(double seconds) {
+    uint64_t ticks = 0, nanos = 0, maxNanos = 0;
+    for (std::unique_ptr<Shard> &shard : shards) {
+      uint64_t shardTicks, shardNanos, shardMax;
+      shard->takeTickStats(shardTicks, shardNanos, shardMax);
+      ticks += shardTicks;
+      nanos += shardNanos;
+      maxNanos = std::max(maxNanos, shardMax);
+    }
+    double sentKB = server->totalSentData / 1024.0;
+    server->totalSentData = 0;
+
+    std::cout << "Stats: " << routes.size() << " players in " << matches.size()
+              << " matches, tick avg " << (ticks ? nanos / 1e6 / ticks : 0.0)
+              << " ms max " << maxNanos / 1e6 << " ms (budget "
+              << 1000.0 / tickRate << " ms), sent " << sentKB / seconds
+              << " kB/s" << std::endl;
+  }
+
+  // Hand the packets every shard has produced to their peers. Packets for
+  // connections that have gone since are dropped.
+  void sendOutgoing() {
+    for (std::unique_ptr<Shard> &shard : shards) {
+      OutgoingPacket packet;
+      while (shard->pollOutgoing(packet)) {
+        auto found = peersByConnection.find(packet.connection);
+        if (found == peersByConnection.end() ||
+            enet_peer_send(found->second, packet.channel, packet.packet) < 0) {
+          enet_packet_destroy(packet.packet);
+        }
+      }
+    }
+  }
+
+public:
+  // With cpus empty no thread is pinned
+  GameServer(int tickRate, size_t maxMatches, int numShards,
+             const std::vector<int> &cpus, double statsInterval)
+      : tickRate(tickRate), maxMatches(maxMatches),
+        statsInterval(statsInterval) {
+    if (enet_initialize() != 0) {
+      throw std::runtime_error("Failed to initialize ENet");
+    }
+
+    ENetAddress address;
+    address.host = ENET_HOST_ANY;
+    address.port = PORT;
+
+    checkVisibilityData();
+
+    server = enet_host_create(&address, maxMatches * PLAYERS_PER_MATCH,
+                              CHANNEL_COUNT, 0, 0);
+    if (!server) {
+      throw std::runtime_error("Failed to create ENet server");
+    }
+
+    // The I/O thread gets the first allowed CPU and each shard one of the
+    // rest
+    bool pinThreads = (int)cpus.size() > numShards;
+    if (pinThreads) {
+      pinCurrentThread(cpus[0]);
+    }
+    for (int i = 0; i < numShards; i++) {
+      shards.push_back(std::unique_ptr<Shard>(
+          new Shard(tickRate, pinThreads ? cpus[i + 1] : -1)));
+      shards.back()->start();
+    }
+    matchesPerShard.assign(shards.size(), 0);
+  }
+
+  void run() {
+    std::cout << "Server running on port " << PORT << " at " << tickRate
+              << " ticks per second, up to " << maxMatches << " matches on "
+              << shards.size() << " shards" << std::endl;
+
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point lastStats = Clock::now();
+    server->totalSentData = 0;
+
+    while (true) {
+      // Queue the shards' packets first so this service call sends them
+      sendOutgoing();
+
+      ENetEvent event;
+      int result = enet_host_service(server, &event, SERVICE_TIMEOUT_MS);
+      while (result > 0) {
+        handleEvent(event);
+        // Handle everything already received before sleeping again
+        result = enet_host_check_events(server, &event);
+      }
+      if (result < 0) {
+        std::cerr << "ENet service failed" << std::endl;
+      }
+
+      double sinceStats =
+          std::chrono::duration<double>(Clock::now() - lastStats).count();
+      if (statsInterval > 0 && sinceStats >= statsInterval) {
+        printStats(sinceStats);
+        lastStats = Clock::now();
+      }
+    }
+  }
+
+  void handleEvent(ENetEvent &event) {
+    switch (event.type) {
+    case ENET_EVENT_TYPE_CONNECT: {
+      std::cout << "Client connected from " << event.peer->address.host
+                << ":" << event.peer->address.port << std::endl;
+
+      MatchInfo *match = findOpenMatch();
+      if (!match) {
+        std::cerr << "Server full, turning the client away" << std::endl;
+        enet_peer_disconnect(event.peer, 0);
+        break;
+      }
+      match->seated++;
+      match->connected++;
+
+      PeerRoute route;
+      route.connection = nextConnection++;
+      if (nextConnection == 0) {
+        nextConnection = 1; // 0 means no connection
+      }
+      route.matchId = match->id;
+      route.shard = match->shard;
+      routes[event.peer] = route;
+      peersByConnection[route.connection] = event.peer;
+
+      ShardEvent joined = {ENET_EVENT_TYPE_CONNECT, route.connection,
+                           route.matchId, nullptr, 0};
+      shards[route.shard]->post(joined);
+      break;
+    }
+    case ENET_EVENT_TYPE_RECEIVE: {
+      auto found = routes.find(event.peer);
+      if (found == routes.end()) {
+        enet_packet_destroy(event.packet);
+        break;
+      }
+      const PeerRoute &route = found->second;
+      ShardEvent received = {ENET_EVENT_TYPE_RECEIVE, route.connection,
+                             route.matchId, event.packet, event.channelID};
+      shards[route.shard]->post(received);
+      break;
+    }
+    case ENET_EVENT_TYPE_DISCONNECT: {
+      std::cout << "Client disconnected" << std::endl;
+      auto found = routes.find(event.peer);
+      if (found == routes.end())
+        break; // Turned away on connect
+      PeerRoute route = found->second;
+      routes.erase(found);
+      peersByConnection.erase(route.connection);
+
+      ShardEvent left = {ENET_EVENT_TYPE_DISCONNECT, route.connection,
+                         route.matchId, nullptr, 0};
+      shards[route.shard]->post(left);
+
+      for (size_t i = 0; i < matches.size(); i++) {
+        if (matches[i].id == route.matchId && --matches[i].connected == 0) {
+          matchesPerShard[matches[i].shard]--;
+          matches.erase(matches.begin() + i);
+          break;
+        }
+      }
+      break;
+    }
+    default:
+      break;
+    }
   }
 
   ~GameServer() {
+    // Stop the shards before the host their packets belong to
+    shards.clear();
     enet_host_destroy(server);
     enet_deinitialize();
   }
 };
 
-int main() {
+int main(int argc, char *argv[]) {
+  int tickRate = DEFAULT_TICK_RATE;
+  int maxMatches = DEFAULT_MAX_MATCHES;
+  // One shard per core we may use, leaving one for the I/O thread
+  std::vector<int> cpus = allowedCpus();
+  int cores = (int)cpus.size();
+  int numShards = std::max(1, cores - 1);
+  bool pinThreads = true;
+  double statsInterval = 0.0;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--tick-rate" && i + 1 < argc) {
+      tickRate = std::atoi(argv[++i]);
+    } else if (arg == "--max-matches" && i + 1 < argc) {
+      maxMatches = std::atoi(argv[++i]);
+    } else if (arg == "--shards" && i + 1 < argc) {
+      numShards = std::atoi(argv[++i]);
+    } else if (arg == "--no-pin") {
+      pinThreads = false;
+    } else if (arg == "--stats" && i + 1 < argc) {
+      statsInterval = std::atof(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--tick-rate HZ] [--max-matches N] [--shards N] [--no-pin]"
+                   " [--stats SECONDS]"
+                << std::endl;
+      return 1;
+    }
+  }
+  if (tickRate < MIN_TICK_RATE || tickRate > MAX_TICK_RATE) {
+    std::cerr << "Tick rate must be between " << MIN_TICK_RATE << " and "
+              << MAX_TICK_RATE << " Hz" << std::endl;
+    return 1;
+  }
+  if (maxMatches < 1 || maxMatches > MAX_MATCHES) {
+    std::cerr << "Match limit must be between 1 and " << MAX_MATCHES
+              << std::endl;
+    return 1;
+  }
+  if (numShards < 1 || numShards > MAX_SHARDS) {
+    std::cerr << "Shard count must be between 1 and " << MAX_SHARDS
+              << std::endl;
+    return 1;
+  }
+  // Pinning more threads than there are cores would stack them up
+  if (pinThreads && numShards + 1 > cores) {
+    std::cout << "Not pinning threads: " << numShards + 1 << " threads on "
+              << cores << " cores" << std::endl;
+    pinThreads = false;
+  }
+  if (!pinThreads) {
+    cpus.clear();
+  }
+
   try {
-    GameServer server;
+    GameServer server(tickRate, maxMatches, numShards, cpus, statsInterval);
     server.run();
   } catch (const std::exception &e) {
     std::cerr << "Error: " << e.what() << std::endl;